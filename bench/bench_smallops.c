@@ -88,15 +88,51 @@ int run_mzed_cling(void *_p, unsigned long long *data, int *data_len) {
   return 0;
 }
 
+static volatile word gf2e_mul_sink;
+
+int run_gf2e_mul(void *_p, unsigned long long *data, int *data_len) {
+  struct smallops_params *p = (struct smallops_params *)_p;
+  *data_len = 2;
+
+  gf2e *ff = gf2e_init(irreducible_polynomials[p->k][1]);
+  const word mask = __M4RI_TWOPOW(ff->degree) - 1;
+
+  word *a = (word*)m4ri_mm_malloc(p->n * sizeof(word));
+  word *b = (word*)m4ri_mm_malloc(p->n * sizeof(word));
+  for(rci_t i=0; i<p->n; i++) {
+    a[i] = random() & mask;
+    b[i] = random() & mask;
+  }
+  word c = 1;
+
+  data[0] = walltime(0);
+  data[1] = cpucycles();
+
+  /* each product depends on the previous one, so table latency is exposed */
+  for(rci_t j=0; j<p->m; j++)
+    for(rci_t i=0; i<p->n; i++)
+      c = gf2e_mul(ff, a[i] ^ c, b[i]) ^ b[i];
+
+  data[1] = cpucycles() - data[1];
+  data[0] = walltime(data[0]);
+
+  m4ri_mm_free(a);
+  m4ri_mm_free(b);
+  gf2e_free(ff);
+  gf2e_mul_sink = c;
+  return 0;
+}
+
 void print_help() {
   printf("bench_smallops:\n\n");
   printf("REQUIRED\n");
-  printf("  e -- integer between 2 and 10\n");
+  printf("  e -- integer between 2 and 16\n");
   printf("  m -- integer > 0\n");
   printf("  n -- integer > 0\n");
-  printf("  what -- mze_cling\n");
-  printf("          mzed_slice\n");
+  printf("  what -- mzed_cling (reports GB/s, see M4RIE_KERNELS)\n");
+  printf("          mzed_slice (reports GB/s, see M4RIE_KERNELS)\n");
   printf("          mzed_add\n");
+  printf("          gf2e_mul (m rounds of n multiplications)\n");
   printf("\n");
   bench_print_global_options(stdout);
 }
@@ -125,12 +161,24 @@ int main(int argc, char **argv) {
     run_bench(run_mzed_cling, (void*)&params, data, 2);
   } else if(strcmp(argv[4],"mzed_add") == 0) {
     run_bench(run_mzed_add, (void*)&params, data, 2);
+  } else if(strcmp(argv[4],"gf2e_mul") == 0) {
+    run_bench(run_gf2e_mul, (void*)&params, data, 2);
   }
 
 
   double cc_per_op = ((double)data[1])/ ( (double)params.m * (double)params.n );
 
-  printf("%s: m: %5d, n: %5d, cpu cycles: %10llu, cc/(mn): %.5lf, wall time: %lf\n", argv[4], params.m, params.n, data[1], cc_per_op, data[0] / 1000000.0);
+  printf("%s: m: %5d, n: %5d, cpu cycles: %10llu, cc/(mn): %.5lf, wall time: %lf", argv[4], params.m, params.n, data[1], cc_per_op, data[0] / 1000000.0);
+
+  if(strcmp(argv[4],"mzed_slice") == 0 || strcmp(argv[4],"mzed_cling") == 0) {
+    /* bytes read plus bytes written, both representations are traversed once */
+    gf2e *ff = gf2e_init(irreducible_polynomials[params.k][1]);
+    const double bits = (double)params.m * (double)params.n * (double)(gf2e_degree_to_w(ff) + ff->degree);
+    printf(", GB/s: %.3lf, kernels: %s", bits / 8.0 / (double)data[0] / 1000.0,
+           (ff->kernels.features & M4RIE_CPU_BMI2) ? "bmi2" : "portable");
+    gf2e_free(ff);
+  }
+  printf("\n");
 }
 
 
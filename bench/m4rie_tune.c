@@ -0,0 +1,249 @@
+#include <m4rie/m4rie.h>
+#include <limits.h>
+#include <unistd.h>
+#include "benchmarking.h"
+
+/**
+ * Measure the crossover points of the dispatchers on this machine and write them as a profile
+ * which can be loaded by setting M4RIE_PROFILE or calling m4rie_profile_load().
+ */
+
+enum tune_op {
+  TUNE_STRASSEN,
+  TUNE_KARATSUBA,
+  TUNE_SLICE_KARATSUBA,
+  TUNE_SLICE_BLM,
+  TUNE_PLE,
+  TUNE_ECHELONIZE_NEWTON_JOHN,
+  TUNE_ECHELONIZE_PLE,
+  TUNE_TRSM,
+  TUNE_TRSM_NAIVE,
+  TUNE_TRSM_NEWTON_JOHN,
+};
+
+static int tune_repeat = 3;
+static int tune_verbose = 1;
+
+/**
+ * Best wall time in seconds of tune_repeat runs of op on n x n matrices over ff.
+ *
+ * For PLE the cutoff is the dimension of the base case, i.e. w*cutoff^2 bits. A Strassen-Winograd
+ * cutoff of 0 selects the one of the profile in use.
+ */
+
+static double tune_time(enum tune_op op, gf2e *ff, rci_t n, rci_t cutoff) {
+  mzed_t *A = mzed_init(ff, n, n);
+  mzed_t *B = mzed_init(ff, n, n);
+  mzed_t *C = mzed_init(ff, n, n);
+  mzed_t *T = mzed_init(ff, n, n);
+  mzd_slice_t *As = NULL, *Bs = NULL, *Cs = NULL;
+  mzp_t *P = mzp_init(n);
+  mzp_t *Q = mzp_init(n);
+
+  mzed_randomize(A);
+  mzed_randomize(B);
+  if (op == TUNE_SLICE_KARATSUBA || op == TUNE_SLICE_BLM) {
+    As = mzed_slice(NULL, A);
+    Bs = mzed_slice(NULL, B);
+    Cs = mzd_slice_init(ff, n, n);
+  }
+  if (op == TUNE_TRSM || op == TUNE_TRSM_NAIVE || op == TUNE_TRSM_NEWTON_JOHN) {
+    for(rci_t i=0; i<n; i++)
+      mzed_write_elem(A, i, i, 1);
+  }
+
+  if (op == TUNE_STRASSEN && cutoff == 0)
+    cutoff = _mzed_strassen_cutoff(C, A, B);
+  if (op == TUNE_PLE)
+    cutoff = A->w * cutoff * cutoff;
+
+  double best = 0.0;
+  for(int r=0; r<tune_repeat; r++) {
+    if (op == TUNE_PLE || op == TUNE_ECHELONIZE_NEWTON_JOHN || op == TUNE_ECHELONIZE_PLE)
+      mzed_copy(T, A);
+    else if (op == TUNE_TRSM || op == TUNE_TRSM_NAIVE || op == TUNE_TRSM_NEWTON_JOHN)
+      mzed_copy(T, B);
+
+    unsigned long long t = walltime(0);
+    switch(op) {
+    case TUNE_STRASSEN:               _mzed_mul_strassen(C, A, B, cutoff); break;
+    case TUNE_KARATSUBA:              _mzed_mul_karatsuba_tiled(C, A, B, __M4RIE_KARATSUBA_TILE); break;
+    case TUNE_SLICE_KARATSUBA:        _mzd_slice_addmul_karatsuba(Cs, As, Bs); break;
+    case TUNE_SLICE_BLM:              _mzd_slice_mul_blm(Cs, As, Bs, NULL); break;
+    case TUNE_PLE:                    _mzed_ple(T, P, Q, cutoff); break;
+    case TUNE_ECHELONIZE_NEWTON_JOHN: mzed_echelonize_newton_john(T, 1); break;
+    case TUNE_ECHELONIZE_PLE:         mzed_echelonize_ple(T, 1); break;
+    case TUNE_TRSM:                   _mzed_trsm_upper_left(A, T, cutoff); break;
+    case TUNE_TRSM_NAIVE:             mzed_trsm_upper_left_naive(A, T); break;
+    case TUNE_TRSM_NEWTON_JOHN:       mzed_trsm_upper_left_newton_john(A, T); break;
+    }
+    t = walltime(t);
+
+    if (r == 0 || t/1e6 < best)
+      best = t/1e6;
+  }
+
+  if (As) {
+    mzd_slice_free(As);
+    mzd_slice_free(Bs);
+    mzd_slice_free(Cs);
+  }
+  mzp_free(P);
+  mzp_free(Q);
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(C);
+  mzed_free(T);
+  return best;
+}
+
+/**
+ * Return the candidate cutoff between lo and hi (powers of two) for which op is fastest on n x n
+ * matrices over ff.
+ */
+
+static rci_t tune_best_cutoff(enum tune_op op, const char *name, gf2e *ff, rci_t n, rci_t lo, rci_t hi) {
+  rci_t best = lo;
+  double best_t = 0.0;
+  for(rci_t c = lo; c <= hi; c *= 2) {
+    const double t = tune_time(op, ff, n, c);
+    if (tune_verbose)
+      fprintf(stderr, "  e: %2d, %-10s n: %5d, cutoff: %5d, %8.4f s\n", ff->degree, name, n, c, t);
+    if (c == lo || t < best_t) {
+      best = c;
+      best_t = t;
+    }
+  }
+  return best;
+}
+
+/**
+ * Return the smallest dimension between lo and hi (powers of two) from which on fast is faster
+ * than slow for all measured dimensions, or 0 if fast does not win at hi. Differences of less than
+ * 5% are considered noise, in which case slow is kept.
+ */
+
+static rci_t tune_crossover(enum tune_op slow, enum tune_op fast, const char *name, gf2e *ff, rci_t lo, rci_t hi, rci_t cutoff) {
+  rci_t crossover = 0;
+  for(rci_t n = lo; n <= hi; n *= 2) {
+    const double ts = tune_time(slow, ff, n, cutoff);
+    const double tf = tune_time(fast, ff, n, cutoff);
+    if (tune_verbose)
+      fprintf(stderr, "  e: %2d, %-10s n: %5d, %8.4f s vs. %8.4f s\n", ff->degree, name, n, ts, tf);
+    if (tf < 0.95*ts) {
+      if (crossover == 0)
+        crossover = n;
+    } else {
+      crossover = 0;
+    }
+  }
+  return crossover;
+}
+
+void print_help() {
+  printf("m4rie-tune:\n\n");
+  printf("Measures the crossover points between algorithms and writes them as a profile, which is\n");
+  printf("used by M4RIE if the environment variable M4RIE_PROFILE points to it.\n\n");
+  printf("OPTIONS\n");
+  printf("  -e a-b -- degrees to tune (default: 2-16)\n");
+  printf("  -n n   -- largest dimension measured, power of two (default: 2048)\n");
+  printf("  -r r   -- number of runs per measurement, the fastest is used (default: 3)\n");
+  printf("  -o f   -- write the profile to f (default: stdout)\n");
+  printf("  -q     -- do not print measurements to stderr\n");
+  printf("\n");
+}
+
+int main(int argc, char **argv) {
+  int emin = 2, emax = M4RIE_MAX_DEGREE;
+  rci_t nmax = 2048;
+  const char *filename = NULL;
+
+  int c;
+  while ((c = getopt(argc, argv, "e:n:r:o:qh")) != -1) {
+    switch(c) {
+    case 'e':
+      if (sscanf(optarg, "%d-%d", &emin, &emax) == 1)
+        emax = emin;
+      break;
+    case 'n': nmax = atoi(optarg); break;
+    case 'r': tune_repeat = atoi(optarg); break;
+    case 'o': filename = optarg; break;
+    case 'q': tune_verbose = 0; break;
+    default:
+      print_help();
+      return 0;
+    }
+  }
+  if (emin < 2 || emax > M4RIE_MAX_DEGREE || emin > emax)
+    m4ri_die("degrees must be between 2 and %d.\n", M4RIE_MAX_DEGREE);
+  if (nmax < 128 || tune_repeat < 1)
+    m4ri_die("-n must be at least 128 and -r at least 1.\n");
+  nmax = 1 << (int)log2((double)nmax);
+
+  srandom(17);
+
+  m4rie_profile_t p;
+  m4rie_profile_defaults(&p);
+
+  for(int e=emin; e<=emax; e++) {
+    gf2e *ff = gf2e_init(irreducible_polynomials[e][1]);
+
+    /* see _mzed_strassen_cutoff() */
+    const rci_t lo = MAX(128, 2*njt_mzed_rows(ff));
+    if (lo <= nmax)
+      p.strassen[e] = tune_best_cutoff(TUNE_STRASSEN, "strassen", ff, nmax, lo, nmax);
+    m4rie_profile_set(&p);
+
+    rci_t k = tune_crossover(TUNE_STRASSEN, TUNE_KARATSUBA, "karatsuba", ff, 64, nmax, 0);
+    p.karatsuba[e] = (k > 0) ? k : 2*nmax;
+
+    p.blm[e] = tune_crossover(TUNE_SLICE_KARATSUBA, TUNE_SLICE_BLM, "blm", ff, 64, nmax, 0);
+
+    /* Newton-John must not fall back to naive while it is measured, naive TRSM is cubic so we
+       stop at twice the rows of a table */
+    p.trsm_newton_john[e] = 1;
+    m4rie_profile_set(&p);
+    const rci_t hi = MIN(nmax, MAX(256, 2*njt_mzed_rows(ff)));
+    const rci_t t = tune_crossover(TUNE_TRSM_NAIVE, TUNE_TRSM_NEWTON_JOHN, "trsm_nj", ff, 16, hi, 0);
+    /* halfway between the last dimension where naive wins and the first where Newton-John wins */
+    p.trsm_newton_john[e] = (t > 0) ? 3*t/4 : hi;
+    m4rie_profile_set(&p);
+
+    gf2e_free(ff);
+  }
+
+  /* PLE, echelon forms and TRSM use multiplication, so they are tuned with the crossovers above
+     in place for one representative degree */
+  {
+    const int e = MIN(MAX(8, emin), emax);
+    gf2e *ff = gf2e_init(irreducible_polynomials[e][1]);
+    const rci_t w = gf2e_degree_to_w(ff);
+
+    /* the profile stores the number of bits of the base case */
+    const rci_t s = tune_best_cutoff(TUNE_PLE, "ple", ff, nmax, 64, nmax/2);
+    p.ple = w*s*s;
+    m4rie_profile_set(&p);
+
+    rci_t x = tune_crossover(TUNE_ECHELONIZE_NEWTON_JOHN, TUNE_ECHELONIZE_PLE, "echelonize", ff, 64, nmax, 0);
+    if (x == 0)
+      x = 2*nmax;
+    /* halfway between the last dimension where Newton-John wins and the first where PLE wins */
+    p.echelonize = (rci_t)MIN((double)w*x*x/2, (double)INT_MAX);
+
+    p.trsm = tune_best_cutoff(TUNE_TRSM, "trsm", ff, nmax, 64, nmax/2);
+    m4rie_profile_set(&p);
+
+    gf2e_free(ff);
+  }
+
+  FILE *fh = stdout;
+  if (filename != NULL) {
+    fh = fopen(filename, "w");
+    if (fh == NULL)
+      m4ri_die("cannot open '%s' for writing.\n", filename);
+  }
+  m4rie_profile_write(&p, fh);
+  if (fh != stdout)
+    fclose(fh);
+  return 0;
+}
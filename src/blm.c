@@ -1,43 +1,121 @@
+#include "config.h"
+
+#ifdef HAVE_OPENMP
+#include <omp.h>
+#endif
+
+#include <string.h>
+
 #include <m4ri/djb.h>
 #include <m4rie/blm.h>
 #include <m4rie/mzd_ptr.h>
+#include <m4rie/profile.h>
+#include <m4rie/threads.h>
+#include <m4rie/workspace.h>
 
+/**
+ * Return the number of bytes used by the rows of an r x c matrix over GF(2).
+ */
 
-void _mzd_ptr_apply_blm_mzd(mzd_t **X, const mzd_t **A, const mzd_t **B, const blm_t *f) {
-  assert((f->H!=NULL) & (f->F!=NULL) & (f->G!=NULL) &
-         (f->H->ncols == f->F->nrows) &   
-         (f->F->nrows == f->G->nrows));
+static inline size_t _mzd_size(const rci_t r, const rci_t c) {
+  return sizeof(word) * (size_t)r * (size_t)((c + m4ri_radix - 1)/m4ri_radix);
+}
 
-  mzd_t *t0 = mzd_init(A[0]->nrows, B[0]->ncols);
-  mzd_t *t1 = mzd_init(A[0]->nrows, A[0]->ncols);
-  mzd_t *t2 = mzd_init(B[0]->nrows, B[0]->ncols);
+/**
+ * Return the linear combination of the matrices in A selected by row i of M.
+ *
+ * If row i of M has exactly one non-zero entry j, then A[j] is returned and T is not touched.
+ * Otherwise the combination is written to T and T is returned.
+ */
 
-  for(rci_t i=0; i < f->F->nrows; i++) {
-    mzd_set_ui(t1, 0);
-    for(rci_t j=0; j < f->F->ncols; j++) {
-      if(mzd_read_bit(f->F, i, j)) {
-        mzd_add(t1, t1, A[j]);
-      }
+static inline const mzd_t *_mzd_ptr_lincomb(mzd_t *T, const mzd_t *M, const rci_t i, const mzd_t **A) {
+  rci_t nonzero = 0;
+  rci_t last = 0;
+  for(rci_t j=0; j < M->ncols; j++) {
+    if(mzd_read_bit(M, i, j)) {
+      nonzero++;
+      last = j;
     }
+  }
+  if (nonzero == 1)
+    return A[last];
 
-    mzd_set_ui(t2, 0);
-    for(rci_t j=0; j < f->G->ncols; j++) {
-      if(mzd_read_bit(f->G, i, j)) {
-        mzd_add(t2, t2, B[j]);
-      }
-    }
+  mzd_set_ui(T, 0);
+  for(rci_t j=0; j < M->ncols; j++) {
+    if(mzd_read_bit(M, i, j))
+      mzd_add(T, T, A[j]);
+  }
+  return T;
+}
+
+
+/**
+ * Apply f on A and B as _mzd_ptr_apply_blm_mzd() does. If GB is not NULL it holds G*B and B is
+ * not read.
+ */
 
+static void _mzd_ptr_apply_blm_mzd_gb(mzd_t **X, const mzd_t **A, const mzd_t **B, const mzd_t **GB, const blm_t *f) {
+  assert((f->H!=NULL) & (f->F!=NULL) & (f->G!=NULL) &
+         (f->H->ncols == f->F->nrows) &   
+         (f->F->nrows == f->G->nrows));
 
-    mzd_mul(t0, t1, t2, 0);
+  const rci_t m = A[0]->nrows;
+  const rci_t l = A[0]->ncols;
+  const rci_t n = (GB != NULL) ? GB[0]->ncols : B[0]->ncols;
+
+#ifdef HAVE_OPENMP
+  const int nthreads = m4rie_parallel_worthwhile(m, l, n) ? m4rie_get_num_threads() : 1;
+
+  /* one lock per output coefficient, the products themselves are independent */
+  omp_lock_t *locks = (omp_lock_t*)m4ri_mm_malloc(sizeof(omp_lock_t)*f->H->nrows);
+  for(rci_t j=0; j < f->H->nrows; j++)
+    omp_init_lock(&locks[j]);
+
+#pragma omp parallel num_threads(nthreads) if(nthreads > 1)
+#endif
+  {
+    /* every thread works with its own buffers, so at most 3*nthreads temporaries are alive */
+    mzd_t *t0 = _mzd_init_scratch(m, n);
+    mzd_t *t1 = _mzd_init_scratch(m, l);
+    mzd_t *t2 = (GB == NULL) ? _mzd_init_scratch(l, n) : NULL;
+
+#ifdef HAVE_OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+    for(rci_t i=0; i < f->F->nrows; i++) {
+      const mzd_t *a = _mzd_ptr_lincomb(t1, f->F, i, A);
+      const mzd_t *b = (GB == NULL) ? _mzd_ptr_lincomb(t2, f->G, i, B) : GB[i];
+
+      mzd_mul(t0, a, b, 0);
+
+      for(rci_t j=0; j < f->H->nrows; j++) {
+        if(mzd_read_bit(f->H, j, i)) {
+#ifdef HAVE_OPENMP
+          omp_set_lock(&locks[j]);
+#endif
+          _mzd_ptr_add_modred(NULL, t0, X, j);
+#ifdef HAVE_OPENMP
+          omp_unset_lock(&locks[j]);
+#endif
+        }
+      }
+    }
 
-    for(rci_t j=0; j < f->H->nrows; j++)
-      if(mzd_read_bit(f->H, j, i))
-        _mzd_ptr_add_modred(NULL, t0, X, j);
+    if (t2)
+      _mzd_free_scratch(t2);
+    _mzd_free_scratch(t1);
+    _mzd_free_scratch(t0);
   }
 
-  mzd_free(t0);
-  mzd_free(t1);
-  mzd_free(t2);
+#ifdef HAVE_OPENMP
+  for(rci_t j=0; j < f->H->nrows; j++)
+    omp_destroy_lock(&locks[j]);
+  m4ri_mm_free(locks);
+#endif
+}
+
+void _mzd_ptr_apply_blm_mzd(mzd_t **X, const mzd_t **A, const mzd_t **B, const blm_t *f) {
+  _mzd_ptr_apply_blm_mzd_gb(X, A, B, NULL, f);
 }
 
 blm_t *_blm_djb_compile(blm_t *f) {
@@ -62,37 +140,64 @@ blm_t *_blm_djb_compile(blm_t *f) {
   return f;
 }
 
-void _mzd_ptr_apply_blm_djb(mzd_t **X, const mzd_t **A, const mzd_t **B, const blm_t *f) {
+/**
+ * Apply f on A and B as _mzd_ptr_apply_blm_djb() does. If GB is not NULL it holds G*B and B is
+ * not read.
+ */
+
+static void _mzd_ptr_apply_blm_djb_gb(mzd_t **X, const mzd_t **A, const mzd_t **B, const mzd_t **GB, const blm_t *f) {
   assert((f->H!=NULL) & (f->F!=NULL) & (f->G!=NULL) &   \
          (f->H->ncols == f->F->nrows) &                 \
          (f->F->nrows == f->G->nrows));
 
- 
+  const rci_t m = A[0]->nrows;
+  const rci_t l = A[0]->ncols;
+  const rci_t n = (GB != NULL) ? GB[0]->ncols : B[0]->ncols;
+
+  /* All F->nrows products are kept alive below, if that is too much we stream them through a
+     fixed number of buffers instead. */
+  const size_t footprint = (size_t)f->F->nrows * (_mzd_size(m, l) + ((GB == NULL) ? _mzd_size(l, n) : 0) + _mzd_size(m, n));
+  if (footprint > m4rie_profile_get()->blm_stream) {
+    /* the streamed products are added to X, but this function overwrites X */
+    for(rci_t j=0; j<f->H->nrows; j++)
+      mzd_set_ui(X[j], 0);
+    _mzd_ptr_apply_blm_mzd_gb(X, A, B, GB, f);
+    return;
+  }
+
   mzd_t **t0 = (mzd_t**)m4ri_mm_malloc(sizeof(mzd_t*)*f->F->nrows);
   mzd_t **t1 = (mzd_t**)m4ri_mm_malloc(sizeof(mzd_t*)*f->F->nrows);
-  mzd_t **t2 = (mzd_t**)m4ri_mm_malloc(sizeof(mzd_t*)*f->F->nrows);
+  mzd_t **t2 = (mzd_t**)m4ri_mm_calloc(f->F->nrows, sizeof(mzd_t*));
 
+  /* temporaries are allocated by this thread, so they may come from its workspace */
   for(rci_t i=0; i<f->F->nrows; i++) {
-    t1[i] = mzd_init(A[0]->nrows, A[0]->ncols);
-    t2[i] = mzd_init(B[0]->nrows, B[0]->ncols);
+    t1[i] = _mzd_init_scratch(m, l);
+    if (GB == NULL)
+      t2[i] = _mzd_init_scratch(l, n);
+    t0[i] = _mzd_init_scratch(m, n);
   }
 
   djb_apply_mzd_ptr(f->f, t1, A);
-  djb_apply_mzd_ptr(f->g, t2, B);
-
+  if (GB == NULL)
+    djb_apply_mzd_ptr(f->g, t2, B);
+  else
+    memcpy(t2, GB, f->F->nrows * sizeof(mzd_t*));
+
+#ifdef HAVE_OPENMP
+  const int nthreads = m4rie_parallel_worthwhile(m, l, n) ? m4rie_get_num_threads() : 1;
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nthreads) if(nthreads > 1)
+#endif
   for(rci_t i=0; i<f->F->nrows; i++) {
-    t0[i] = mzd_init(A[0]->nrows, B[0]->ncols);
     mzd_mul(t0[i], t1[i], t2[i], 0);
-    mzd_free(t1[i]);
-    mzd_free(t2[i]);
   }
 
-  
-
   djb_apply_mzd_ptr(f->h, X, (const mzd_t**)t0);
 
-  for(rci_t i=0; i<f->F->nrows; i++) {
-    mzd_free(t0[i]);
+  for(rci_t i=f->F->nrows-1; i>=0; i--) {
+    _mzd_free_scratch(t0[i]);
+    if (GB == NULL)
+      _mzd_free_scratch(t2[i]);
+    _mzd_free_scratch(t1[i]);
   }
 
   m4ri_mm_free(t0);
@@ -100,6 +205,43 @@ void _mzd_ptr_apply_blm_djb(mzd_t **X, const mzd_t **A, const mzd_t **B, const b
   m4ri_mm_free(t2);
 }
 
+void _mzd_ptr_apply_blm_djb(mzd_t **X, const mzd_t **A, const mzd_t **B, const blm_t *f) {
+  _mzd_ptr_apply_blm_djb_gb(X, A, B, NULL, f);
+}
+
+mzd_t **_mzd_ptr_blm_prepare(const mzd_t **B, const blm_t *f) {
+  const rci_t l = B[0]->nrows;
+  const rci_t n = B[0]->ncols;
+
+  mzd_t **GB = (mzd_t**)m4ri_mm_malloc(sizeof(mzd_t*)*f->G->nrows);
+  for(rci_t i=0; i<f->G->nrows; i++)
+    GB[i] = mzd_init(l, n);
+
+  if (f->g != NULL) {
+    djb_apply_mzd_ptr(f->g, GB, B);
+  } else {
+    for(rci_t i=0; i<f->G->nrows; i++) {
+      const mzd_t *b = _mzd_ptr_lincomb(GB[i], f->G, i, B);
+      if (b != GB[i])
+        mzd_copy(GB[i], b);
+    }
+  }
+  return GB;
+}
+
+void _mzd_ptr_blm_prepared_free(mzd_t **GB, const blm_t *f) {
+  for(rci_t i=0; i<f->G->nrows; i++)
+    mzd_free(GB[i]);
+  m4ri_mm_free(GB);
+}
+
+void _mzd_ptr_apply_blm_prepared(mzd_t **X, const mzd_t **A, const mzd_t **GB, const blm_t *f) {
+  if (f->f!=NULL)
+    _mzd_ptr_apply_blm_djb_gb(X, A, NULL, GB, f);
+  else
+    _mzd_ptr_apply_blm_mzd_gb(X, A, NULL, GB, f);
+}
+
 
 
 int *crt_init(const deg_t f_len, const deg_t g_len) {
@@ -619,3 +761,109 @@ void blm_free(blm_t *f) {
 
   m4ri_mm_free(f);
 }
+
+/**
+ * A cached bilinear map together with the key it was computed for.
+ */
+
+typedef struct blm_cache_entry_struct {
+  word minpoly;              /*!< minimal polynomial of the field or 0 for plain polynomials */
+  deg_t f_ncols;             /*!< length of the first operand */
+  deg_t g_ncols;             /*!< length of the second operand */
+  int p[M4RIE_CRT_LEN];      /*!< CRT plan */
+  blm_t *f;                  /*!< the bilinear map */
+  struct blm_cache_entry_struct *next;
+} blm_cache_entry_t;
+
+static blm_cache_entry_t *blm_cache = NULL;
+
+static blm_t *_blm_cache_lookup(const word minpoly, const deg_t f_ncols, const deg_t g_ncols, const int *p) {
+  for(blm_cache_entry_t *e = blm_cache; e != NULL; e = e->next) {
+    if (e->minpoly == minpoly && e->f_ncols == f_ncols && e->g_ncols == g_ncols &&
+        memcmp(e->p, p, M4RIE_CRT_LEN*sizeof(int)) == 0)
+      return e->f;
+  }
+  return NULL;
+}
+
+const blm_t *blm_cache_get(const gf2e *ff, const deg_t f_ncols, const deg_t g_ncols, const int *p) {
+  const word minpoly = (ff != NULL) ? ff->minpoly : 0;
+  blm_t *f;
+
+#ifdef HAVE_OPENMP
+#pragma omp critical (m4rie_blm_cache)
+#endif
+  f = _blm_cache_lookup(minpoly, f_ncols, g_ncols, p);
+
+  if (f != NULL)
+    return f;
+
+  /* computing the map is expensive, so we do it outside of the critical section and throw our
+     copy away if another thread was quicker. */
+
+  blm_t *g = blm_init_crt(ff, f_ncols, g_ncols, p, 1);
+
+  blm_cache_entry_t *e = (blm_cache_entry_t*)m4ri_mm_malloc(sizeof(blm_cache_entry_t));
+  e->minpoly = minpoly;
+  e->f_ncols = f_ncols;
+  e->g_ncols = g_ncols;
+  memcpy(e->p, p, M4RIE_CRT_LEN*sizeof(int));
+  e->f = g;
+
+#ifdef HAVE_OPENMP
+#pragma omp critical (m4rie_blm_cache)
+#endif
+  {
+    f = _blm_cache_lookup(minpoly, f_ncols, g_ncols, p);
+    if (f == NULL) {
+      e->next = blm_cache;
+      blm_cache = e;
+      f = g;
+    }
+  }
+
+  if (f != g) {
+    blm_free(g);
+    m4ri_mm_free(e);
+  }
+  return f;
+}
+
+const blm_t *blm_cache_get_field(const gf2e *ff) {
+  const deg_t d = ff->degree;
+  if (d > M4RIE_MAX_DEGREE)
+    m4ri_die("degrees > %d unsupported.\n", M4RIE_MAX_DEGREE);
+  int p[M4RIE_CRT_LEN] = {0};
+  p[d] = 1;
+  return blm_cache_get(ff, d, d, p);
+}
+
+const blm_t *blm_cache_get_crt(const deg_t f_ncols, const deg_t g_ncols) {
+  int *p = crt_init(f_ncols, g_ncols);
+  const blm_t *f = blm_cache_get(NULL, f_ncols, g_ncols, p);
+  m4ri_mm_free(p);
+  return f;
+}
+
+void blm_cache_warm(const gf2e *ff) {
+  blm_cache_get_field(ff);
+}
+
+void blm_cache_clear(void) {
+  blm_cache_entry_t *e;
+
+#ifdef HAVE_OPENMP
+#pragma omp critical (m4rie_blm_cache)
+#endif
+  {
+    e = blm_cache;
+    blm_cache = NULL;
+  }
+
+  while(e != NULL) {
+    blm_cache_entry_t *next = e->next;
+    blm_free(e->f);
+    m4ri_mm_free(e);
+    e = next;
+  }
+}
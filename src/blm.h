@@ -111,6 +111,57 @@ blm_t *_blm_finish_polymult(const gf2e *ff, blm_t *f);
 
 void blm_free(blm_t *f);
 
+/**
+ * \brief Return the bilinear map for the CRT plan p from the process-wide cache.
+ *
+ * The map is computed with blm_init_crt(ff, f_ncols, g_ncols, p, 1) the first time it is
+ * requested and shared by all subsequent callers. Maps for fields are keyed by their minimal
+ * polynomial, so two gf2e objects for the same field share one map.
+ *
+ * \param ff Finite field for modular reduction or NULL for polynomial multiplication over \GF2.
+ * \param f_ncols Length of the first operand.
+ * \param g_ncols Length of the second operand.
+ * \param p CRT plan as returned by crt_init().
+ *
+ * \note The returned map is owned by the cache and must not be modified or passed to blm_free().
+ *
+ * \note This function is thread-safe if M4RIE was built with OpenMP.
+ */
+
+const blm_t *blm_cache_get(const gf2e *ff, const deg_t f_ncols, const deg_t g_ncols, const int *p);
+
+/**
+ * \brief Return the cached bilinear map realising multiplication in ff.
+ *
+ * \param ff Finite field.
+ */
+
+const blm_t *blm_cache_get_field(const gf2e *ff);
+
+/**
+ * \brief Return the cached bilinear map for multiplying polynomials of length f_ncols and
+ * g_ncols over \GF2 using the CRT plan returned by crt_init().
+ */
+
+const blm_t *blm_cache_get_crt(const deg_t f_ncols, const deg_t g_ncols);
+
+/**
+ * \brief Compute the bilinear map for multiplication in ff ahead of time.
+ *
+ * \param ff Finite field.
+ */
+
+void blm_cache_warm(const gf2e *ff);
+
+/**
+ * \brief Free all cached bilinear maps.
+ *
+ * \warning Maps previously returned by blm_cache_get() become invalid, so this must not be
+ * called while other threads are multiplying.
+ */
+
+void blm_cache_clear(void);
+
 /**
  * \brief Compile DJB map for f
  *  
@@ -120,7 +171,20 @@ void blm_free(blm_t *f);
 blm_t *_blm_djb_compile(blm_t *f);
 
 /**
- * \brief Apply f (stored as a matrix) on A and B, writing to X
+ * \brief Default temporary memory (in bytes) _mzd_ptr_apply_blm_djb() may use before it switches
+ * to _mzd_ptr_apply_blm_mzd() which streams the products through a bounded number of buffers.
+ *
+ * The limit in use is the blm_stream entry of the profile, see m4rie_profile_t.
+ */
+
+#define __M4RIE_BLM_STREAM_CUTOFF (__M4RI_CPU_L2_CACHE<<8)
+
+/**
+ * \brief Apply f (stored as a matrix) on A and B, adding the result to X
+ *
+ * The pointwise products are computed one at a time, so only three temporary matrices are
+ * needed per thread. If OpenMP is enabled and the matrices are large enough, the products are
+ * distributed over m4rie_get_num_threads() threads.
  *  
  * \param X Array of matrices
  * \param A Array of matrices 
@@ -132,6 +196,11 @@ void _mzd_ptr_apply_blm_mzd(mzd_t **X, const mzd_t **A, const mzd_t **B, const b
 
 /**
  * \brief Apply f (stored as a DJB map) on A and B, writing to X
+ *
+ * This keeps all f->F->nrows pointwise products in memory. If these temporaries would exceed
+ * m4rie_profile_get()->blm_stream bytes, X is cleared and _mzd_ptr_apply_blm_mzd() is called
+ * instead. If OpenMP is enabled and the matrices are large enough, the pointwise products are
+ * computed in parallel.
  *  
  * \param X Array of matrices
  * \param A Array of matrices 
@@ -157,5 +226,40 @@ static inline void _mzd_ptr_apply_blm(mzd_t **X, const mzd_t **A, const mzd_t **
     _mzd_ptr_apply_blm_mzd(X, A, B, f);
 }
 
+/**
+ * \brief Return G*B, i.e. f->G->nrows matrices, so that B does not have to be transformed for
+ * every product with the same B.
+ *
+ * \param B Array of matrices
+ * \param f Bilinear map
+ *
+ * \sa _mzd_ptr_apply_blm_prepared() _mzd_ptr_blm_prepared_free()
+ */
+
+mzd_t **_mzd_ptr_blm_prepare(const mzd_t **B, const blm_t *f);
+
+/**
+ * \brief Free matrices returned by _mzd_ptr_blm_prepare().
+ *
+ * \param GB Array of matrices
+ * \param f Bilinear map passed to _mzd_ptr_blm_prepare()
+ */
+
+void _mzd_ptr_blm_prepared_free(mzd_t **GB, const blm_t *f);
+
+/**
+ * \brief Apply f on A and B, writing to X, where GB was returned by _mzd_ptr_blm_prepare() for B.
+ *
+ * GB may also be an array of windows into the matrices returned by _mzd_ptr_blm_prepare(), in
+ * which case the product with the same window of B is computed.
+ *
+ * \param X Array of matrices
+ * \param A Array of matrices
+ * \param GB Array of matrices
+ * \param f Bilinear map
+ */
+
+void _mzd_ptr_apply_blm_prepared(mzd_t **X, const mzd_t **A, const mzd_t **GB, const blm_t *f);
+
 
 #endif //M4RIE_BLM_H
@@ -17,7 +17,14 @@
 *                  http://www.gnu.org/licenses/
 ******************************************************************************/
 
+#include "config.h"
+
+#ifdef HAVE_OPENMP
+#include <omp.h>
+#endif
+
 #include "conversion.h"
+#include "threads.h"
 
 static inline word word_slice_64_02(word a) {
   a = (a & xcccccccc) | (a & xcccccccc>> 2)<< 1;
@@ -53,71 +60,180 @@ static inline word word_cling_64_04(word a) {
   return a;
 }
 
+/**
+ * Number of threads converting an m x n matrix over ff, every thread gets one block of rows.
+ */
+
+static int _mzed_conversion_threads(const gf2e *ff, const rci_t m, const rci_t n) {
+#ifdef HAVE_OPENMP
+  const int nthreads = m4rie_get_num_threads();
+  if (nthreads <= 1 || omp_in_parallel())
+    return 1;
+  if ((double)m * (double)n * (double)gf2e_degree_to_w(ff) < (double)__M4RIE_CONVERSION_PARALLEL_CUTOFF)
+    return 1;
+  return MIN(nthreads, m);
+#else
+  return 1;
+#endif
+}
+
 mzd_slice_t *mzed_slice(mzd_slice_t *A, const mzed_t *Z) {
-  if (A == NULL) {
+  const int clear = (A != NULL);
+  if (A == NULL)
     A = mzd_slice_init(Z->finite_field, Z->nrows, Z->ncols);
-  } else {
-    mzd_slice_set_ui(A, 0);
+
+  const int nthreads = _mzed_conversion_threads(Z->finite_field, Z->nrows, Z->ncols);
+  if (nthreads == 1) {
+    if (clear)
+      mzd_slice_set_ui(A, 0);
+    return Z->finite_field->kernels.slice(A, Z);
   }
 
-  switch(Z->finite_field->degree) {
-  case  2: return _mzed_slice2(A,Z);
-
-  case  3: return _mzed_slice4(A,Z);
-  case  4: return _mzed_slice4(A,Z);
-
-  case  5: return _mzed_slice8(A,Z);
-  case  6: return _mzed_slice8(A,Z);
-  case  7: return _mzed_slice8(A,Z);
-  case  8: return _mzed_slice8(A,Z);
-
-  case  9: return _mzed_slice16(A,Z);
-  case 10: return _mzed_slice16(A,Z);
-  case 11: return _mzed_slice16(A,Z);
-  case 12: return _mzed_slice16(A,Z);
-  case 13: return _mzed_slice16(A,Z);
-  case 14: return _mzed_slice16(A,Z);
-  case 15: return _mzed_slice16(A,Z);
-  case 16: return _mzed_slice16(A,Z);
-  default:
-    m4ri_die("slicing not implemented for this degree");
+  /* rows are independent and every block only writes its own rows of the slices */
+#ifdef HAVE_OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(nthreads)
+#endif
+  for(int t=0; t<nthreads; t++) {
+    const rci_t lowr  = (rci_t)(((size_t)Z->nrows *  t   ) / nthreads);
+    const rci_t highr = (rci_t)(((size_t)Z->nrows * (t+1)) / nthreads);
+    mzd_slice_t *At = mzd_slice_init_window(A, lowr, 0, highr, A->ncols);
+    mzed_t *Zt = mzed_init_window(Z, lowr, 0, highr, Z->ncols);
+    if (clear)
+      mzd_slice_set_ui(At, 0);
+    Z->finite_field->kernels.slice(At, Zt);
+    mzed_free_window(Zt);
+    mzd_slice_free_window(At);
   }
   return A;
 }
 
 mzed_t *mzed_cling(mzed_t *A, const mzd_slice_t *Z) {
-  if (A == NULL) {
+  const int clear = (A != NULL);
+  if (A == NULL)
     A = mzed_init(Z->finite_field, Z->nrows, Z->ncols);
-  }
-  else {
-    mzed_set_ui(A, 0);
+
+  const int nthreads = _mzed_conversion_threads(Z->finite_field, Z->nrows, Z->ncols);
+  if (nthreads == 1) {
+    if (clear)
+      mzed_set_ui(A, 0);
+    return Z->finite_field->kernels.cling(A, Z);
   }
 
-  switch(Z->finite_field->degree) {
-  case  2: return _mzed_cling2(A,Z);
-
-  case  3: return _mzed_cling4(A,Z);
-  case  4: return _mzed_cling4(A,Z);
-
-  case  5: return _mzed_cling8(A,Z);
-  case  6: return _mzed_cling8(A,Z);
-  case  7: return _mzed_cling8(A,Z);
-  case  8: return _mzed_cling8(A,Z);
-
-  case  9: return _mzed_cling16(A,Z);
-  case 10: return _mzed_cling16(A,Z);
-  case 11: return _mzed_cling16(A,Z);
-  case 12: return _mzed_cling16(A,Z);
-  case 13: return _mzed_cling16(A,Z);
-  case 14: return _mzed_cling16(A,Z);
-  case 15: return _mzed_cling16(A,Z);
-  case 16: return _mzed_cling16(A,Z);
-  default:
-    m4ri_die("clinging not implemented for this degree");
+#ifdef HAVE_OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(nthreads)
+#endif
+  for(int t=0; t<nthreads; t++) {
+    const rci_t lowr  = (rci_t)(((size_t)Z->nrows *  t   ) / nthreads);
+    const rci_t highr = (rci_t)(((size_t)Z->nrows * (t+1)) / nthreads);
+    mzed_t *At = mzed_init_window(A, lowr, 0, highr, A->ncols);
+    mzd_slice_t *Zt = mzd_slice_init_window(Z, lowr, 0, highr, Z->ncols);
+    if (clear)
+      mzed_set_ui(At, 0);
+    Z->finite_field->kernels.cling(At, Zt);
+    mzd_slice_free_window(Zt);
+    mzed_free_window(At);
   }
   return A;
 }
 
+/**
+ * C[i0:i0+tile, j0:j0+tile] (+)= A[i0:i0+tile, :] * B[:, j0:j0+tile] with all temporaries taken
+ * from the workspace of the calling thread. If P is not NULL, B is the matrix P was prepared
+ * from and tiles of B are not converted but taken from P.
+ */
+
+static void _mzed_karatsuba_tile(mzed_t *C, const mzed_t *A, const mzed_t *B, const mzed_prepared_t *P,
+                                 const rci_t i0, const rci_t j0, const rci_t tile, const int addmul) {
+  const gf2e *ff = A->finite_field;
+  const rci_t i1 = MIN(i0 + tile, C->nrows);
+  const rci_t j1 = MIN(j0 + tile, C->ncols);
+
+  mzed_t *Cw = mzed_init_window(C, i0, j0, i1, j1);
+  mzd_slice_t *Cs = _mzd_slice_init_scratch(ff, i1 - i0, j1 - j0);
+  if (addmul)
+    mzed_slice(Cs, Cw);
+
+  for(rci_t k0 = 0; k0 < A->ncols; k0 += tile) {
+    const rci_t k1 = MIN(k0 + tile, A->ncols);
+    mzed_t *Aw = mzed_init_window(A, i0, k0, i1, k1);
+    mzd_slice_t *As = mzed_slice(_mzd_slice_init_scratch(ff, i1 - i0, k1 - k0), Aw);
+
+    if (P != NULL) {
+      _mzd_slice_addmul_prepared(Cs, As, P, k0, j0);
+    } else {
+      mzed_t *Bw = mzed_init_window(B, k0, j0, k1, j1);
+      mzd_slice_t *Bs = mzed_slice(_mzd_slice_init_scratch(ff, k1 - k0, j1 - j0), Bw);
+      _mzd_slice_addmul(Cs, As, Bs);
+      _mzd_slice_free_scratch(Bs);
+      mzed_free_window(Bw);
+    }
+
+    _mzd_slice_free_scratch(As);
+    mzed_free_window(Aw);
+  }
+
+  mzed_cling(Cw, Cs);
+  _mzd_slice_free_scratch(Cs);
+  mzed_free_window(Cw);
+}
+
+static mzed_t *_mzed_karatsuba_tiled(mzed_t *C, const mzed_t *A, const mzed_t *B, const mzed_prepared_t *P, rci_t tile, const int addmul) {
+  if (C == NULL)
+    C = mzed_init(A->finite_field, A->nrows, B->ncols);
+  if ((C->nrows | C->ncols) == 0)
+    return C;
+
+  /* tile boundaries must be word aligned in both representations */
+  tile = MAX(tile - tile % m4ri_radix, m4ri_radix);
+  const rci_t mt = (C->nrows + tile - 1) / tile;
+  const rci_t nt = (C->ncols + tile - 1) / tile;
+  const int ntiles = mt * nt;
+
+  int nthreads = 1;
+#ifdef HAVE_OPENMP
+  if (!omp_in_parallel() && ntiles >= m4rie_get_num_threads())
+    nthreads = m4rie_get_num_threads();
+#endif
+
+#ifdef HAVE_OPENMP
+#pragma omp parallel num_threads(nthreads) if(nthreads > 1)
+#endif
+  {
+    /* temporaries of one tile have the same shapes as those of the next one */
+    m4rie_workspace_t *ws = NULL;
+    if (m4rie_workspace_get() == NULL) {
+      ws = m4rie_workspace_init(0, 0);
+      m4rie_workspace_attach(ws);
+    }
+
+#ifdef HAVE_OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+    for(int t=0; t<ntiles; t++)
+      _mzed_karatsuba_tile(C, A, B, P, (t / nt) * tile, (t % nt) * tile, tile, addmul);
+
+    if (ws)
+      m4rie_workspace_free(ws);
+  }
+  return C;
+}
+
+mzed_t *_mzed_mul_karatsuba_tiled(mzed_t *C, const mzed_t *A, const mzed_t *B, rci_t tile) {
+  return _mzed_karatsuba_tiled(C, A, B, NULL, tile, 0);
+}
+
+mzed_t *_mzed_addmul_karatsuba_tiled(mzed_t *C, const mzed_t *A, const mzed_t *B, rci_t tile) {
+  return _mzed_karatsuba_tiled(C, A, B, NULL, tile, 1);
+}
+
+mzed_t *_mzed_mul_karatsuba_prepared(mzed_t *C, const mzed_t *A, const mzed_prepared_t *P, rci_t tile) {
+  return _mzed_karatsuba_tiled(C, A, P->B, P, tile, 0);
+}
+
+mzed_t *_mzed_addmul_karatsuba_prepared(mzed_t *C, const mzed_t *A, const mzed_prepared_t *P, rci_t tile) {
+  return _mzed_karatsuba_tiled(C, A, P->B, P, tile, 1);
+}
+
 mzd_slice_t *_mzed_slice2(mzd_slice_t *T, const mzed_t *F) {
   assert(T && (T->depth >= 2));
   size_t j, j2 = 0;
@@ -31,10 +31,22 @@
 #include <m4ri/m4ri.h>
 #include <m4rie/mzed.h>
 #include <m4rie/mzd_slice.h>
+#include <m4rie/workspace.h>
+#include <m4rie/mzed_prepared.h>
+
+/**
+ * \brief Minimal number of bits of the packed matrix before mzed_slice() and mzed_cling() split
+ * its rows between threads.
+ */
+
+#define __M4RIE_CONVERSION_PARALLEL_CUTOFF (1<<22)
 
 /**
  * \brief Pack a bitslice matrix into a packed represenation.
  *
+ * If M4RIE was built with OpenMP and Z is large enough, blocks of rows are converted in parallel.
+ * A and Z may be windows.
+ *
  * \param A Matrix over \GF2E or NULL
  * \param Z Bitslice matrix over \GF2E
  *
@@ -46,6 +58,9 @@ mzed_t *mzed_cling(mzed_t *A, const mzd_slice_t *Z);
 /**
  * \brief Unpack the matrix Z into bitslice representation.
  *
+ * If M4RIE was built with OpenMP and Z is large enough, blocks of rows are converted in parallel.
+ * A and Z may be windows.
+ *
  * \param A Bitslice matrix or NULL
  * \param Z Input matrix
  *
@@ -135,6 +150,28 @@ mzed_t *_mzed_cling8(mzed_t *A, const mzd_slice_t *Z);
 
 mzed_t *_mzed_cling16(mzed_t *A, const mzd_slice_t *Z);
 
+/**
+ * \brief Bitslice a packed matrix for any degree using PEXT (BMI2).
+ *
+ * Only available if HAVE_TARGET_BMI2 is defined and only to be called if the CPU supports BMI2.
+ *
+ * \param A Bitslice matrix over \GF2E
+ * \param Z Matrix over \GF2E
+ */
+
+mzd_slice_t *_mzed_slice_bmi2(mzd_slice_t *A, const mzed_t *Z);
+
+/**
+ * \brief Pack a bitslice matrix for any degree using PDEP (BMI2).
+ *
+ * Only available if HAVE_TARGET_BMI2 is defined and only to be called if the CPU supports BMI2.
+ *
+ * \param A Matrix over \GF2E
+ * \param Z Bitslice matrix over \GF2E
+ */
+
+mzed_t *_mzed_cling_bmi2(mzed_t *A, const mzd_slice_t *Z);
+
 /**
  * \brief Compute C += A*B using Karatsuba multiplication of polynomials over GF(2).
  *
@@ -146,24 +183,123 @@ mzed_t *_mzed_cling16(mzed_t *A, const mzd_slice_t *Z);
  */
 
 static inline mzed_t *_mzed_addmul_karatsuba(mzed_t *C, const mzed_t *A, const mzed_t *B) {
-  mzd_slice_t *As,*Bs,*Cs;
-  if(C)
-    Cs = mzed_slice(NULL,C);
-  else
-    Cs = NULL;
-  As = mzed_slice(NULL,A);
-  Bs = mzed_slice(NULL,B);
+  /* a new C is zero, so the accumulator starts from a zero scratch matrix without slicing C */
+  mzd_slice_t *Cs = _mzd_slice_init_scratch(A->finite_field, A->nrows, B->ncols);
+  if (C != NULL)
+    mzed_slice(Cs, C);
+  mzd_slice_t *As = mzed_slice(_mzd_slice_init_scratch(A->finite_field, A->nrows, A->ncols), A);
+  mzd_slice_t *Bs = mzed_slice(_mzd_slice_init_scratch(B->finite_field, B->nrows, B->ncols), B);
 
-  Cs = _mzd_slice_addmul_karatsuba(Cs, As, Bs);
+  _mzd_slice_addmul_karatsuba(Cs, As, Bs);
 
   C = mzed_cling(C, Cs);
 
-  mzd_slice_free(As);
-  mzd_slice_free(Bs);
-  mzd_slice_free(Cs);
+  _mzd_slice_free_scratch(Bs);
+  _mzd_slice_free_scratch(As);
+  _mzd_slice_free_scratch(Cs);
   return C;
 }
 
+/**
+ * \brief Compute C = A*B using Karatsuba multiplication of polynomials over GF(2).
+ *
+ * Unlike _mzed_addmul_karatsuba() the previous content of C is not converted to bitsliced
+ * representation.
+ *
+ * \param C Preallocated return matrix, may be NULL for automatic creation.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ *
+ * \sa _mzd_slice_addmul_karatsuba
+ */
+
+static inline mzed_t *_mzed_mul_karatsuba(mzed_t *C, const mzed_t *A, const mzed_t *B) {
+  mzd_slice_t *Cs = _mzd_slice_init_scratch(A->finite_field, A->nrows, B->ncols);
+  mzd_slice_t *As = mzed_slice(_mzd_slice_init_scratch(A->finite_field, A->nrows, A->ncols), A);
+  mzd_slice_t *Bs = mzed_slice(_mzd_slice_init_scratch(B->finite_field, B->nrows, B->ncols), B);
+
+  _mzd_slice_addmul_karatsuba(Cs, As, Bs);
+
+  C = mzed_cling(C, Cs);
+
+  _mzd_slice_free_scratch(Bs);
+  _mzd_slice_free_scratch(As);
+  _mzd_slice_free_scratch(Cs);
+  return C;
+}
+
+/**
+ * \brief Default number of rows and columns of the tiles of _mzed_mul_karatsuba_tiled().
+ */
+
+#define __M4RIE_KARATSUBA_TILE 4096
+
+/**
+ * \brief Compute C = A*B using Karatsuba multiplication on tiles.
+ *
+ * Instead of converting A, B and C to bitsliced representation as a whole, C is split into tiles
+ * of at most tile x tile elements. For every tile of C the matching tiles of A and B are
+ * converted one pair at a time and multiplied with _mzd_slice_addmul(), and the tile of C is
+ * converted back when it is complete. Thus, the extra memory is three tiles (plus what the
+ * products need) instead of copies of all three matrices.
+ *
+ * If M4RIE was built with OpenMP and there are at least as many tiles of C as threads, every
+ * thread processes its own tiles of C, such that conversions on one thread overlap with products
+ * on the others. Otherwise tiles are processed one after another by parallel conversions and
+ * products.
+ *
+ * \param C Preallocated return matrix, may be NULL for automatic creation.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ * \param tile Number of rows and columns of a tile, rounded down to a multiple of m4ri_radix.
+ *
+ * \sa _mzed_mul_karatsuba() __M4RIE_KARATSUBA_TILE
+ */
+
+mzed_t *_mzed_mul_karatsuba_tiled(mzed_t *C, const mzed_t *A, const mzed_t *B, rci_t tile);
+
+/**
+ * \brief Compute C += A*B using Karatsuba multiplication on tiles.
+ *
+ * \param C Preallocated return matrix.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ * \param tile Number of rows and columns of a tile, rounded down to a multiple of m4ri_radix.
+ *
+ * \sa _mzed_mul_karatsuba_tiled()
+ */
+
+mzed_t *_mzed_addmul_karatsuba_tiled(mzed_t *C, const mzed_t *A, const mzed_t *B, rci_t tile);
+
+/**
+ * \brief Compute C = A*B using Karatsuba multiplication on tiles where P was prepared from B.
+ *
+ * Same as _mzed_mul_karatsuba_tiled() except that tiles of B are taken from P instead of being
+ * converted for every tile of C.
+ *
+ * \param C Preallocated return matrix, may be NULL for automatic creation.
+ * \param A Input matrix A.
+ * \param P Prepared matrix B.
+ * \param tile Number of rows and columns of a tile, rounded down to a multiple of m4ri_radix.
+ *
+ * \sa mzed_mul_prepared()
+ */
+
+mzed_t *_mzed_mul_karatsuba_prepared(mzed_t *C, const mzed_t *A, const mzed_prepared_t *P, rci_t tile);
+
+/**
+ * \brief Compute C += A*B using Karatsuba multiplication on tiles where P was prepared from B.
+ *
+ * \param C Preallocated return matrix.
+ * \param A Input matrix A.
+ * \param P Prepared matrix B.
+ * \param tile Number of rows and columns of a tile, rounded down to a multiple of m4ri_radix.
+ *
+ * \sa _mzed_mul_karatsuba_prepared()
+ */
+
+mzed_t *_mzed_addmul_karatsuba_prepared(mzed_t *C, const mzed_t *A, const mzed_prepared_t *P, rci_t tile);
+
 /**
  * \brief Compute C = A*B.
  *
@@ -180,9 +316,8 @@ static inline mzed_t *mzed_mul_karatsuba(mzed_t *C, const mzed_t *A, const mzed_
   if (C != NULL) {
     if (C->finite_field != A->finite_field || C->nrows != A->nrows || C->ncols != B->ncols) 
       m4ri_die("mzed_mul_karatsuba: rows and columns of returned matrix must match.\n");
-    mzed_set_ui(C,0);
   }
-  return _mzed_addmul_karatsuba(C, A, B);
+  return _mzed_mul_karatsuba(C, A, B);
 }
 
 /**
@@ -0,0 +1,172 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include "config.h"
+
+#ifdef HAVE_TARGET_BMI2
+
+#include <immintrin.h>
+
+#include "conversion.h"
+
+/**
+ * A word of a packed matrix holds 64/w elements of w bits each. Bit k of all these elements is
+ * selected by the mask with bit k of every w-bit field set, so one PEXT extracts 64/w bits of
+ * slice k and one PDEP puts them back. w consecutive packed words make up one word of each slice.
+ */
+
+static inline word _mzed_bmi2_mask(const int w) {
+  switch(w) {
+  case  2: return 0x5555555555555555ULL;
+  case  4: return 0x1111111111111111ULL;
+  case  8: return 0x0101010101010101ULL;
+  default: return 0x0001000100010001ULL;
+  }
+}
+
+/**
+ * Convert one row. Called with constant w and e so that the loops over the slices are unrolled.
+ */
+
+__attribute__((target("bmi2"), always_inline))
+static inline void _mzed_slice_bmi2_row(word **t, const word *f, const wi_t width, const word bitmask_end,
+                                        const int w, const int e) {
+  const int per = m4ri_radix / w;
+  const word mask = _mzed_bmi2_mask(w);
+  word r[16];
+
+  wi_t j = 0, j2 = 0;
+  for(; j + w < width; j += w, j2++) {
+    for(int k=0; k<e; k++)
+      r[k] = 0;
+    for(int jj=0; jj<w; jj++)
+      for(int k=0; k<e; k++)
+        r[k] |= _pext_u64(f[j + jj], mask<<k) << (jj * per);
+    for(int k=0; k<e; k++)
+      t[k][j2] = r[k];
+  }
+
+  /* last word of each slice, bits beyond the last column are left untouched */
+  for(int k=0; k<e; k++)
+    r[k] = 0;
+  for(int jj=0; j + jj < width; jj++)
+    for(int k=0; k<e; k++)
+      r[k] |= _pext_u64(f[j + jj], mask<<k) << (jj * per);
+  for(int k=0; k<e; k++)
+    t[k][j2] = (t[k][j2] & ~bitmask_end) | (r[k] & bitmask_end);
+}
+
+__attribute__((target("bmi2"), always_inline))
+static inline void _mzed_cling_bmi2_row(word *t, const word **s, const wi_t width, const word bitmask_end,
+                                        const int w, const int e) {
+  const int per = m4ri_radix / w;
+  const word mask = _mzed_bmi2_mask(w);
+  const word per_mask = __M4RI_LEFT_BITMASK(per);
+
+  wi_t j = 0, j2 = 0;
+  for(; j + w < width; j += w, j2++) {
+    for(int jj=0; jj<w; jj++) {
+      word a = 0;
+      for(int k=0; k<e; k++)
+        a |= _pdep_u64((s[k][j2] >> (jj * per)) & per_mask, mask<<k);
+      t[j + jj] = a;
+    }
+  }
+
+  /* last word of each slice, bits beyond the last column are left untouched */
+  word a = 0;
+  for(int jj=0; j + jj < width; jj++) {
+    a = 0;
+    for(int k=0; k<e; k++)
+      a |= _pdep_u64((s[k][j2] >> (jj * per)) & per_mask, mask<<k);
+    if (j + jj < width - 1)
+      t[j + jj] = a;
+  }
+  t[width-1] = (t[width-1] & ~bitmask_end) | (a & bitmask_end);
+}
+
+__attribute__((target("bmi2")))
+mzd_slice_t *_mzed_slice_bmi2(mzd_slice_t *T, const mzed_t *F) {
+  const wi_t width = F->x->width;
+  const word bitmask_end = T->x[0]->high_bitmask;
+  word *t[16];
+
+  for(rci_t i=0; i<T->nrows; i++) {
+    const word *f = F->x->rows[i];
+    for(int k=0; k<T->depth; k++)
+      t[k] = T->x[k]->rows[i];
+
+    switch(T->depth) {
+    case  2: _mzed_slice_bmi2_row(t, f, width, bitmask_end,  2,  2); break;
+    case  3: _mzed_slice_bmi2_row(t, f, width, bitmask_end,  4,  3); break;
+    case  4: _mzed_slice_bmi2_row(t, f, width, bitmask_end,  4,  4); break;
+    case  5: _mzed_slice_bmi2_row(t, f, width, bitmask_end,  8,  5); break;
+    case  6: _mzed_slice_bmi2_row(t, f, width, bitmask_end,  8,  6); break;
+    case  7: _mzed_slice_bmi2_row(t, f, width, bitmask_end,  8,  7); break;
+    case  8: _mzed_slice_bmi2_row(t, f, width, bitmask_end,  8,  8); break;
+    case  9: _mzed_slice_bmi2_row(t, f, width, bitmask_end, 16,  9); break;
+    case 10: _mzed_slice_bmi2_row(t, f, width, bitmask_end, 16, 10); break;
+    case 11: _mzed_slice_bmi2_row(t, f, width, bitmask_end, 16, 11); break;
+    case 12: _mzed_slice_bmi2_row(t, f, width, bitmask_end, 16, 12); break;
+    case 13: _mzed_slice_bmi2_row(t, f, width, bitmask_end, 16, 13); break;
+    case 14: _mzed_slice_bmi2_row(t, f, width, bitmask_end, 16, 14); break;
+    case 15: _mzed_slice_bmi2_row(t, f, width, bitmask_end, 16, 15); break;
+    case 16: _mzed_slice_bmi2_row(t, f, width, bitmask_end, 16, 16); break;
+    default:
+      m4ri_die("degree %d not supported.\n", T->depth);
+    }
+  }
+  return T;
+}
+
+__attribute__((target("bmi2")))
+mzed_t *_mzed_cling_bmi2(mzed_t *T, const mzd_slice_t *F) {
+  const wi_t width = T->x->width;
+  const word bitmask_end = T->x->high_bitmask;
+  const word *s[16];
+
+  for(rci_t i=0; i<T->nrows; i++) {
+    word *t = T->x->rows[i];
+    for(int k=0; k<F->depth; k++)
+      s[k] = F->x[k]->rows[i];
+
+    switch(F->depth) {
+    case  2: _mzed_cling_bmi2_row(t, s, width, bitmask_end,  2,  2); break;
+    case  3: _mzed_cling_bmi2_row(t, s, width, bitmask_end,  4,  3); break;
+    case  4: _mzed_cling_bmi2_row(t, s, width, bitmask_end,  4,  4); break;
+    case  5: _mzed_cling_bmi2_row(t, s, width, bitmask_end,  8,  5); break;
+    case  6: _mzed_cling_bmi2_row(t, s, width, bitmask_end,  8,  6); break;
+    case  7: _mzed_cling_bmi2_row(t, s, width, bitmask_end,  8,  7); break;
+    case  8: _mzed_cling_bmi2_row(t, s, width, bitmask_end,  8,  8); break;
+    case  9: _mzed_cling_bmi2_row(t, s, width, bitmask_end, 16,  9); break;
+    case 10: _mzed_cling_bmi2_row(t, s, width, bitmask_end, 16, 10); break;
+    case 11: _mzed_cling_bmi2_row(t, s, width, bitmask_end, 16, 11); break;
+    case 12: _mzed_cling_bmi2_row(t, s, width, bitmask_end, 16, 12); break;
+    case 13: _mzed_cling_bmi2_row(t, s, width, bitmask_end, 16, 13); break;
+    case 14: _mzed_cling_bmi2_row(t, s, width, bitmask_end, 16, 14); break;
+    case 15: _mzed_cling_bmi2_row(t, s, width, bitmask_end, 16, 15); break;
+    case 16: _mzed_cling_bmi2_row(t, s, width, bitmask_end, 16, 16); break;
+    default:
+      m4ri_die("degree %d not supported.\n", F->depth);
+    }
+  }
+  return T;
+}
+
+#endif //HAVE_TARGET_BMI2
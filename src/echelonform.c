@@ -22,11 +22,12 @@
 #include "permutation.h"
 #include "trsm.h"
 #include "ple.h"
+#include "profile.h"
 
 rci_t mzed_echelonize(mzed_t *A, int full) {
   if (A->finite_field->degree > A->nrows) {
     return mzed_echelonize_naive(A, full);
-  } else if ((A->nrows * A->ncols * A->w <= 2*__M4RIE_PLE_CUTOFF)) {
+  } else if ((A->nrows * A->ncols * A->w <= m4rie_profile_get()->echelonize)) {
     return mzed_echelonize_newton_john(A, full);
   } else {
     return mzed_echelonize_ple(A, full);
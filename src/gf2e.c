@@ -1,7 +1,13 @@
+#include "config.h"
+
 #include <m4ri/m4ri.h>
 #include "gf2e.h"
 
 gf2e *gf2e_init(const word minpoly) {
+  return gf2e_init_flags(minpoly, 0);
+}
+
+gf2e *gf2e_init_flags(const word minpoly, const int flags) {
   gf2e *ff = (gf2e*)m4ri_mm_calloc(1, sizeof(gf2e));
 
   for(int i=0; i<=M4RIE_MAX_DEGREE; i++)
@@ -34,15 +40,23 @@ gf2e *gf2e_init(const word minpoly) {
     }
   }
 
+  /** x^(2e) / minpoly **/
+  word r = __M4RI_TWOPOW(2*ff->degree);
+  ff->_barrett = 0;
+  for(int i=2*ff->degree; i>=ff->degree; i--) {
+    if (r & __M4RI_TWOPOW(i)) {
+      ff->_barrett |= __M4RI_TWOPOW(i - ff->degree);
+      r ^= minpoly<<(i - ff->degree);
+    }
+  }
+
   if(ff->degree <= 8) {
     /** mul tables **/
-    ff->_mul = (word **)m4ri_mm_calloc(order, sizeof(word *));
-    ff->_mul[0] = (word *)m4ri_mm_calloc(order, sizeof(word));
-    for(unsigned int i = 1; i<order; i++) {
-      ff->_mul[i] = (word *)m4ri_mm_calloc(order, sizeof(word));
-      for(unsigned int j=1; j<order; j++) {
+    ff->_mul = (uint8_t *)m4ri_mm_malloc_aligned(order * order, 64); /* one cache line */
+    for(unsigned int i = 0; i<order; i++) {
+      for(unsigned int j=0; j<order; j++) {
         word res = gf2x_mul(i,j, ff->degree);
-        ff->_mul[i][j] = res ^ ff->red[res>>ff->degree];
+        ff->_mul[(i<<ff->degree) | j] = res ^ ff->red[res>>ff->degree];
       }
     }
     ff->mul = _gf2e_mul_table;
@@ -50,20 +64,167 @@ gf2e *gf2e_init(const word minpoly) {
     ff->mul = _gf2e_mul_arith;
   }
   ff->inv = gf2e_inv;
+
+  if(ff->degree <= 8 || (flags & M4RIE_GF2E_LOG_TABLES)) {
+    /** log/exp tables, minpoly need not be primitive so we search for a generator **/
+    ff->_log = (uint16_t*)m4ri_mm_calloc(order, sizeof(uint16_t));
+    ff->_exp = (uint16_t*)m4ri_mm_calloc(order, sizeof(uint16_t));
+    for(word g=2; g<order; g++) {
+      word y = 1;
+      unsigned int i;
+      for(i=0; i<order-1; i++) {
+        ff->_exp[i] = y;
+        ff->_log[y] = i;
+        y = _gf2e_mul_arith(ff, y, g);
+        if (y == 1)
+          break;
+      }
+      if (i == order-2)
+        break;
+    }
+  }
+
+  ff->_t16_cache = (gf2e_t16_cache_t*)m4ri_mm_calloc(1, sizeof(gf2e_t16_cache_t));
+
+  gf2e_select_kernels(ff, gf2e_cpu_features());
   return ff;
 }
 
 void gf2e_free(gf2e *ff) {
-  if (ff->_mul) {
-    for(size_t i=0; i<__M4RI_TWOPOW(ff->degree); i++) {
-      m4ri_mm_free(ff->_mul[i]);
-    }
+  if (ff->_mul)
     m4ri_mm_free(ff->_mul);
+  if (ff->_log) {
+    m4ri_mm_free(ff->_log);
+    m4ri_mm_free(ff->_exp);
   }
+  for(int i=0; i<__M4RIE_T16_CACHE_SIZE; i++)
+    if (ff->_t16_cache->entry[i].mul)
+      m4ri_mm_free(ff->_t16_cache->entry[i].mul);
+  m4ri_mm_free(ff->_t16_cache);
   m4ri_mm_free(ff->pow_gen);
   m4ri_mm_free(ff->red);
 }
 
+static inline word _gf2e_t16_mul(const gf2e *ff, const word a, const word b) {
+  /* lanes holding values >= 2^e never occur in valid matrices */
+  return (b < __M4RI_TWOPOW(ff->degree)) ? gf2e_mul(ff, a, b) : 0;
+}
+
+static uint16_t *_gf2e_t16_build(const gf2e *ff, const word a) {
+  uint16_t *mul;
+
+  if (ff->degree > 8) {
+    /* by linearity a*b = a*(b & 0xff) + a*(b & 0xff00) */
+    mul = (uint16_t*)m4ri_mm_malloc_aligned(2*256*sizeof(uint16_t), 64);
+    for(word i=0; i<256; i++) {
+      mul[      i] = _gf2e_t16_mul(ff, a, i);
+      mul[256 + i] = _gf2e_t16_mul(ff, a, i<<8);
+    }
+    return mul;
+  }
+
+  /* products for one byte of packed elements, the table for 16 bits is built from these */
+  const deg_t w = gf2e_degree_to_w(ff);
+  const word mask_w = __M4RI_TWOPOW(w) - 1;
+  uint8_t mul8[256];
+  for(word i=0; i<256; i++) {
+    word r = 0;
+    for(deg_t j=0; j<8; j+=w)
+      r |= _gf2e_t16_mul(ff, a, (i>>j) & mask_w)<<j;
+    mul8[i] = r;
+  }
+
+  mul = (uint16_t*)m4ri_mm_malloc_aligned(__M4RI_TWOPOW(16)*sizeof(uint16_t), 64);
+  for(word i=0; i<256; i++)
+    for(word j=0; j<256; j++)
+      mul[i<<8 | j] = mul8[i]<<8 | mul8[j];
+  return mul;
+}
+
+static gf2e_t16_t *_gf2e_t16_lookup(gf2e_t16_cache_t *cache, const word a) {
+  for(int i=0; i<__M4RIE_T16_CACHE_SIZE; i++) {
+    gf2e_t16_t *t = cache->entry + i;
+    if (t->mul != NULL && t->a == a) {
+      t->refs++;
+      t->last_use = ++cache->clock;
+      return t;
+    }
+  }
+  return NULL;
+}
+
+const gf2e_t16_t *gf2e_t16_get(const gf2e *ff, const word a) {
+  gf2e_t16_cache_t *cache = ff->_t16_cache;
+  gf2e_t16_t *t;
+
+#ifdef HAVE_OPENMP
+#pragma omp critical (m4rie_t16_cache)
+#endif
+  t = _gf2e_t16_lookup(cache, a);
+
+  if (t != NULL)
+    return t;
+
+  /* building the table is expensive, so we do it outside of the critical section */
+
+  uint16_t *mul = _gf2e_t16_build(ff, a);
+
+#ifdef HAVE_OPENMP
+#pragma omp critical (m4rie_t16_cache)
+#endif
+  {
+    t = _gf2e_t16_lookup(cache, a);
+    if (t == NULL) {
+      /* pick an empty slot or the least recently used one nobody holds */
+      for(int i=0; i<__M4RIE_T16_CACHE_SIZE; i++) {
+        gf2e_t16_t *s = cache->entry + i;
+        if (s->mul == NULL) {
+          t = s;
+          break;
+        }
+        if (s->refs == 0 && (t == NULL || s->last_use < t->last_use))
+          t = s;
+      }
+      if (t != NULL) {
+        if (t->mul != NULL)
+          m4ri_mm_free(t->mul);
+        t->a = a;
+        t->mul = mul;
+        t->refs = 1;
+        t->last_use = ++cache->clock;
+        mul = NULL;
+      }
+    }
+  }
+
+  if (t == NULL) {
+    /* all slots are in use, the caller gets a private table */
+    t = (gf2e_t16_t*)m4ri_mm_malloc(sizeof(gf2e_t16_t));
+    t->a = a;
+    t->mul = mul;
+    t->refs = 1;
+    t->last_use = 0;
+  } else if (mul != NULL) {
+    m4ri_mm_free(mul);
+  }
+  return t;
+}
+
+void gf2e_t16_release(const gf2e *ff, const gf2e_t16_t *t) {
+  gf2e_t16_cache_t *cache = ff->_t16_cache;
+
+  if (t < cache->entry || t >= cache->entry + __M4RIE_T16_CACHE_SIZE) {
+    m4ri_mm_free(t->mul);
+    m4ri_mm_free((gf2e_t16_t*)t);
+    return;
+  }
+
+#ifdef HAVE_OPENMP
+#pragma omp critical (m4rie_t16_cache)
+#endif
+  ((gf2e_t16_t*)t)->refs--;
+}
+
 const word _irreducible_polynomials_degree_01[   3]  = {    2, 0x00002, 0x00003 };
 const word _irreducible_polynomials_degree_02[   2]  = {    1, 0x00007 };
 const word _irreducible_polynomials_degree_03[   3]  = {    2, 0x0000b, 0x0000d };
@@ -43,6 +43,71 @@
 
 typedef struct gf2e_struct gf2e;
 
+/**
+ * \brief Precomputed data for multiplying packed elements by a fixed element a.
+ *
+ * For elements of width w <= 8 multiplying all elements packed into a byte by a is linear over
+ * GF(2), hence it is determined by its images on the low and the high nibble. The same map is also
+ * stored as an 8 x 8 bit matrix in the format expected by the GF2P8AFFINEQB instruction. For w = 16
+ * only ff and a are set.
+ */
+
+typedef struct {
+  uint8_t lo[16]; /**< lo[i] = a*i for the elements in the nibble i. */
+  uint8_t hi[16]; /**< hi[i] = a*(i<<4) for the elements in the nibble i<<4. */
+  uint64_t affine; /**< The same map as 8 x 8 bit matrix for GF2P8AFFINEQB. */
+  const gf2e *ff; /**< The finite field. */
+  word a; /**< The multiplier. */
+} gf2e_split_t;
+
+struct mzed_struct;
+struct mzd_slice_struct;
+
+/**
+ * \brief CPU supports SSSE3 (PSHUFB).
+ */
+
+#define M4RIE_CPU_SSSE3  0x01
+
+/**
+ * \brief CPU supports AVX2.
+ */
+
+#define M4RIE_CPU_AVX2   0x02
+
+/**
+ * \brief CPU supports GFNI (GF2P8AFFINEQB).
+ */
+
+#define M4RIE_CPU_GFNI   0x04
+
+/**
+ * \brief CPU supports PCLMULQDQ.
+ */
+
+#define M4RIE_CPU_PCLMUL 0x08
+
+/**
+ * \brief CPU supports BMI2 (PEXT/PDEP) and executes it in hardware.
+ */
+
+#define M4RIE_CPU_BMI2   0x10
+
+/**
+ * \brief Row-level kernels for a given field, selected at runtime.
+ *
+ * \sa gf2e_select_kernels()
+ */
+
+typedef struct {
+  void (*scale_row)(word *c, const gf2e_split_t *t, const wi_t n); /**< c[i] = a*c[i] for n words of packed elements, may be NULL if e > 8. */
+  void (*addmul_row)(word *c, const word *b, const gf2e_split_t *t, const wi_t n); /**< c[i] += a*b[i] for n words of packed elements, may be NULL if e > 8. */
+  word (*dot_row)(const gf2e *ff, const word *a, const word *b, const wi_t n); /**< sum of a[i]*b[i] over all elements in n words. */
+  struct mzd_slice_struct *(*slice)(struct mzd_slice_struct *T, const struct mzed_struct *F); /**< _mzed_slice*() for this field. */
+  struct mzed_struct *(*cling)(struct mzed_struct *T, const struct mzd_slice_struct *F); /**< _mzed_cling*() for this field. */
+  unsigned int features; /**< CPU features (M4RIE_CPU_*) used by the kernels above. */
+} gf2e_kernels_t;
+
 /**
  * \brief \GF2E
  */
@@ -53,12 +118,30 @@ struct gf2e_struct {
 
   word *pow_gen; /**< pow_gen[i] holds \f$a^i / \langle f\rangle\f$ for \f$a\f$ a generator of this field.*/
   word *red;     /**< red[i] holds precomputed reductors for the minpoly.*/
-  word **_mul;   /**< mul[a][b] holds \f$ a \cdot b\f$ for small fields.*/
+  uint8_t *_mul; /**< _mul[a<<e | b] holds \f$ a \cdot b\f$ for e <= 8 in a contiguous table of \f$2^{2e}\f$ bytes.*/
+  word _barrett; /**< \f$\lfloor x^{2e} / minpoly \rfloor\f$ for Barrett reduction.*/
+  uint16_t *_log; /**< _log[a] holds i such that \f$g^i = a\f$ for a generator g or NULL.*/
+  uint16_t *_exp; /**< _exp[i] holds \f$g^i\f$ or NULL.*/
 
   word (*inv)(const gf2e *ff, const word a); /**< implements \f$a^{-1}\f$ for a in \GF2E*/
   word (*mul)(const gf2e *ff, const word a, const word b); /**< implements \f$a \cdot b\f$ for a in \GF2E.*/
+
+  gf2e_kernels_t kernels; /**< Row-level kernels, see gf2e_select_kernels(). */
+  struct gf2e_t16_cache_struct *_t16_cache; /**< Recently used scalar tables, see gf2e_t16_get(). */
 };
 
+/**
+ * \brief Build log/antilog tables for fields with e > 8.
+ *
+ * The tables take \f$2^{e+2}\f$ bytes, i.e. 256KB for e = 16. They make gf2e_inv() a single lookup
+ * and gf2e_mul() two lookups and an addition instead of a polynomial multiplication and
+ * reduction. For e <= 8 they are always built since they take at most 1KB.
+ *
+ * \sa gf2e_init_flags()
+ */
+
+#define M4RIE_GF2E_LOG_TABLES 0x01
+
 /**
  * Create finite field from minimal polynomial
  *
@@ -67,6 +150,15 @@ struct gf2e_struct {
 
 gf2e *gf2e_init(const word minpoly);
 
+/**
+ * Create finite field from minimal polynomial with optional precomputed tables.
+ *
+ * \param minpoly Polynomial represented as series of bits.
+ * \param flags Bitwise or of M4RIE_GF2E_* flags, 0 is equivalent to gf2e_init().
+ */
+
+gf2e *gf2e_init_flags(const word minpoly, const int flags);
+
 /**
  * Free ff
  *
@@ -80,6 +172,10 @@ void gf2e_free(gf2e *ff);
  */
 
 static inline word gf2e_inv(const gf2e *ff, word a) {
+  if (ff->_log != NULL) {
+    const unsigned int q = __M4RI_TWOPOW(ff->degree) - 1;
+    return ff->_exp[(q - ff->_log[a]) % q];
+  }
   return gf2x_invmod(a, ff->minpoly, ff->degree);
 }
 
@@ -88,7 +184,7 @@ static inline word gf2e_inv(const gf2e *ff, word a) {
  */
 
 static inline word _gf2e_mul_table(const gf2e *ff, const word a, const word b) {
-  return ff->_mul[a][b];
+  return ff->_mul[(a<<ff->degree) | b];
 }
 
 /**
@@ -100,6 +196,20 @@ static inline word _gf2e_mul_arith(const gf2e *ff, const word a, const word b) {
   return res ^ ff->red[res>>ff->degree];
 }
 
+/**
+ * \brief a*b in \GF2E using log/antilog tables.
+ */
+
+static inline word _gf2e_mul_log(const gf2e *ff, const word a, const word b) {
+  if (a == 0 || b == 0)
+    return 0;
+  const unsigned int q = __M4RI_TWOPOW(ff->degree) - 1;
+  unsigned int s = (unsigned int)ff->_log[a] + ff->_log[b];
+  if (s >= q)
+    s -= q;
+  return ff->_exp[s];
+}
+
 /**
  * \brief a*b in \GF2E.
  */
@@ -107,8 +217,10 @@ static inline word _gf2e_mul_arith(const gf2e *ff, const word a, const word b) {
 static inline word gf2e_mul(const gf2e *ff, const word a, const word b) {
   if( ff->_mul != NULL )
     return _gf2e_mul_table(ff, a, b);
+  else if( ff->_log != NULL )
+    return _gf2e_mul_log(ff, a, b);
   else
-    return _gf2e_mul_arith(ff, a, b);
+    return ff->mul(ff, a, b);
 }
 
 /**
@@ -190,6 +302,139 @@ static inline void gf2e_t16_free(word *mul) {
   m4ri_mm_free(mul);
 }
 
+/**
+ * \brief Number of scalar tables kept by each field.
+ *
+ * For e <= 8 a table takes 128KB, for e > 8 it takes 1KB.
+ */
+
+#define __M4RIE_T16_CACHE_SIZE 8
+
+/**
+ * \brief Table for multiplying packed elements by a fixed scalar.
+ *
+ * For e <= 8, mul[i] holds a*i for all \f$2^{16}\f$ values of 16 bits of packed elements. For e >
+ * 8 elements take 16 bits and the product is split into the low and high byte of the element:
+ * mul[i] holds a*i and mul[256 + i] holds a*(i<<8) for 0 <= i < 256.
+ *
+ * \sa gf2e_t16_get()
+ */
+
+typedef struct {
+  word a;                 /**< The scalar. */
+  uint16_t *mul;          /**< The table, NULL if this cache slot is empty. */
+  int refs;               /**< Number of users, only entries with refs == 0 are evicted. */
+  unsigned long last_use; /**< Time stamp for LRU eviction. */
+} gf2e_t16_t;
+
+/**
+ * \brief LRU cache of scalar tables attached to a field.
+ */
+
+typedef struct gf2e_t16_cache_struct {
+  gf2e_t16_t entry[__M4RIE_T16_CACHE_SIZE]; /**< Cache slots. */
+  unsigned long clock;                      /**< Incremented on every access. */
+} gf2e_t16_cache_t;
+
+/**
+ * \brief Return a table for multiplying packed elements by a.
+ *
+ * Tables are kept in a small LRU cache attached to ff so that scaling by the same few constants
+ * repeatedly does not rebuild them. This function is thread safe. Every table must be returned
+ * with gf2e_t16_release().
+ *
+ * \param ff Finite field.
+ * \param a Finite field element.
+ */
+
+const gf2e_t16_t *gf2e_t16_get(const gf2e *ff, const word a);
+
+/**
+ * \brief Release a table obtained from gf2e_t16_get().
+ *
+ * \param ff Finite field.
+ * \param t Table.
+ */
+
+void gf2e_t16_release(const gf2e *ff, const gf2e_t16_t *t);
+
+/**
+ * \brief Return a*b for all elements packed in the word b, e <= 8.
+ *
+ * \param t Table for a.
+ * \param b Packed elements.
+ */
+
+static inline word gf2e_t16_mul_word(const gf2e_t16_t *t, const word b) {
+  const uint16_t *mul = t->mul;
+  return ((word)mul[b>>48         ])<<48 | ((word)mul[b>>32 & 0xffff])<<32 |
+         ((word)mul[b>>16 & 0xffff])<<16 | ((word)mul[b     & 0xffff]);
+}
+
+/**
+ * \brief Return a*b for all elements packed in the word b, e > 8.
+ *
+ * \param t Table for a.
+ * \param b Packed elements.
+ */
+
+static inline word gf2e_t16_mul_word16(const gf2e_t16_t *t, const word b) {
+  const uint16_t *lo = t->mul;
+  const uint16_t *hi = t->mul + 256;
+  word r = 0;
+  for(int i=0; i<64; i+=16)
+    r |= ((word)(lo[(b>>i) & 0xff] ^ hi[(b>>(i+8)) & 0xff]))<<i;
+  return r;
+}
+
+/**
+ * \brief Prepare t for multiplying packed elements by a.
+ *
+ * \param t Split tables.
+ * \param ff Finite field.
+ * \param a Finite field element.
+ */
+
+void gf2e_split_init(gf2e_split_t *t, const gf2e *ff, const word a);
+
+/**
+ * \brief Return a*b for all elements packed in the word b.
+ *
+ * \param t Split tables for a, computed by gf2e_split_init() for a field with e <= 8.
+ * \param b Word of packed elements.
+ */
+
+static inline word gf2e_split_word(const gf2e_split_t *t, const word b) {
+  word r = 0;
+  for(int i=0; i<m4ri_radix; i+=8) {
+    const word v = (b>>i) & 0xff;
+    r |= (word)(t->lo[v & 0xf] ^ t->hi[v>>4])<<i;
+  }
+  return r;
+}
+
+/**
+ * \brief Return the CPU features (M4RIE_CPU_*) M4RIE may use.
+ *
+ * These are the features supported by both the compiler and the CPU. If the environment variable
+ * M4RIE_KERNELS is set to a comma separated list of features ("ssse3", "avx2", "gfni", "pclmul",
+ * "bmi2") only these are reported, "portable" disables all SIMD kernels. This allows to benchmark each variant with
+ * the same binary.
+ */
+
+unsigned int gf2e_cpu_features(void);
+
+/**
+ * \brief Select the fastest row kernels for ff which only use the given CPU features.
+ *
+ * gf2e_init() calls this function with gf2e_cpu_features().
+ *
+ * \param ff Finite field.
+ * \param features Bitmask of M4RIE_CPU_* values, 0 selects the portable kernels.
+ */
+
+void gf2e_select_kernels(gf2e *ff, unsigned int features);
+
 /**
  * \brief all Irreducible polynomials over GF(2) up to degree 16.
  */
@@ -0,0 +1,443 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include "config.h"
+
+#if defined(HAVE_TARGET_SSSE3) || defined(HAVE_TARGET_AVX2) || defined(HAVE_TARGET_GFNI) || defined(HAVE_TARGET_PCLMUL)
+#include <immintrin.h>
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "conversion.h"
+
+/**
+ * The kernels below multiply packed elements of width w <= 8 by a fixed element. Elements never
+ * straddle byte boundaries, so each byte is mapped through the split tables in gf2e_split_t: one
+ * lookup for the low and one for the high nibble. PSHUFB performs 16 (SSSE3) or 32 (AVX2) of these
+ * lookups at once, GF2P8AFFINEQB (GFNI) applies the whole 8 x 8 bit matrix in one instruction.
+ *
+ * For 8 < e <= 16 multiplication is implemented with carry-less multiplication (PCLMULQDQ)
+ * followed by Barrett reduction, which needs two further carry-less products but no tables.
+ *
+ * The SIMD kernels are compiled with target attributes and only called if the CPU supports them,
+ * so the library does not need to be built with SIMD_FLAGS.
+ */
+
+static inline word _gf2e_mul_byte(const gf2e *ff, const word a, const word v, const int w) {
+  const word mask_w = (1<<w)-1;
+  word r = 0;
+  for(int i=0; i<8; i+=w)
+    r |= gf2e_mul(ff, a, (v>>i) & mask_w)<<i;
+  return r;
+}
+
+void gf2e_split_init(gf2e_split_t *t, const gf2e *ff, const word a) {
+  const int w = gf2e_degree_to_w(ff);
+  t->ff = ff;
+  t->a = a;
+  if (w > 8)
+    return;
+
+  word b[8];
+  for(int j=0; j<8; j++)
+    b[j] = _gf2e_mul_byte(ff, a, 1<<j, w);
+
+  for(int i=0; i<16; i++) {
+    word lo = 0, hi = 0;
+    for(int j=0; j<4; j++) {
+      if (i & 1<<j) {
+        lo ^= b[j];
+        hi ^= b[j+4];
+      }
+    }
+    t->lo[i] = (uint8_t)lo;
+    t->hi[i] = (uint8_t)hi;
+  }
+
+  /* bit i of the output is the parity of the input masked by byte 7-i of the matrix */
+  t->affine = 0;
+  for(int i=0; i<8; i++) {
+    word row = 0;
+    for(int j=0; j<8; j++)
+      row |= ((b[j]>>i) & 1)<<j;
+    t->affine |= row<<(8*(7-i));
+  }
+}
+
+static void _gf2e_addmul_row_table(word *c, const word *b, const gf2e_split_t *t, const wi_t n) {
+  for(wi_t i=0; i<n; i++)
+    c[i] ^= gf2e_split_word(t, b[i]);
+}
+
+static void _gf2e_scale_row_table(word *c, const gf2e_split_t *t, const wi_t n) {
+  for(wi_t i=0; i<n; i++)
+    c[i] = gf2e_split_word(t, c[i]);
+}
+
+/**
+ * sum_i a_i*b_i = sum_j x^j * (sum_i a_{i,j}*b_i) where a_{i,j} is the j-th bit of a_i. The inner
+ * sums are computed for all elements of a word at once by masking b with the j-th bits of a
+ * spread to the full element width. The result is reduced only once at the end.
+ */
+
+static word _gf2e_dot_row_bitsliced(const gf2e *ff, const word *a, const word *b, const wi_t n) {
+  const int w = gf2e_degree_to_w(ff);
+  const word mask_w = __M4RI_LEFT_BITMASK(w);
+  word low = 0;
+  for(int i=0; i<m4ri_radix; i+=w)
+    low |= m4ri_one<<i;
+
+  word acc[M4RIE_MAX_DEGREE] = {0};
+  for(wi_t i=0; i<n; i++) {
+    const word ai = a[i];
+    const word bi = b[i];
+    for(deg_t j=0; j<ff->degree; j++)
+      acc[j] ^= bi & (((ai>>j) & low) * mask_w);
+  }
+
+  word r = 0;
+  for(deg_t j=0; j<ff->degree; j++) {
+    word v = acc[j];
+    for(int i=m4ri_radix/2; i>=w; i/=2)
+      v ^= v>>i;
+    r ^= (v & mask_w)<<j;
+  }
+  return r ^ ff->red[r>>ff->degree];
+}
+
+#ifdef HAVE_TARGET_SSSE3
+
+__attribute__((target("ssse3")))
+static inline __m128i _gf2e_split_ssse3(const __m128i x, const __m128i lo, const __m128i hi, const __m128i mask) {
+  const __m128i l = _mm_shuffle_epi8(lo, _mm_and_si128(x, mask));
+  const __m128i h = _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi64(x, 4), mask));
+  return _mm_xor_si128(l, h);
+}
+
+__attribute__((target("ssse3")))
+static void _gf2e_addmul_row_ssse3(word *c, const word *b, const gf2e_split_t *t, const wi_t n) {
+  const __m128i lo = _mm_loadu_si128((const __m128i*)t->lo);
+  const __m128i hi = _mm_loadu_si128((const __m128i*)t->hi);
+  const __m128i mask = _mm_set1_epi8(0x0f);
+  wi_t i = 0;
+  for(; i+2 <= n; i+=2) {
+    const __m128i x = _gf2e_split_ssse3(_mm_loadu_si128((const __m128i*)(b+i)), lo, hi, mask);
+    _mm_storeu_si128((__m128i*)(c+i), _mm_xor_si128(_mm_loadu_si128((const __m128i*)(c+i)), x));
+  }
+  for(; i<n; i++)
+    c[i] ^= gf2e_split_word(t, b[i]);
+}
+
+__attribute__((target("ssse3")))
+static void _gf2e_scale_row_ssse3(word *c, const gf2e_split_t *t, const wi_t n) {
+  const __m128i lo = _mm_loadu_si128((const __m128i*)t->lo);
+  const __m128i hi = _mm_loadu_si128((const __m128i*)t->hi);
+  const __m128i mask = _mm_set1_epi8(0x0f);
+  wi_t i = 0;
+  for(; i+2 <= n; i+=2) {
+    const __m128i x = _gf2e_split_ssse3(_mm_loadu_si128((const __m128i*)(c+i)), lo, hi, mask);
+    _mm_storeu_si128((__m128i*)(c+i), x);
+  }
+  for(; i<n; i++)
+    c[i] = gf2e_split_word(t, c[i]);
+}
+
+#endif //HAVE_TARGET_SSSE3
+
+#ifdef HAVE_TARGET_AVX2
+
+__attribute__((target("avx2")))
+static inline __m256i _gf2e_split_avx2(const __m256i x, const __m256i lo, const __m256i hi, const __m256i mask) {
+  const __m256i l = _mm256_shuffle_epi8(lo, _mm256_and_si256(x, mask));
+  const __m256i h = _mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi64(x, 4), mask));
+  return _mm256_xor_si256(l, h);
+}
+
+__attribute__((target("avx2")))
+static void _gf2e_addmul_row_avx2(word *c, const word *b, const gf2e_split_t *t, const wi_t n) {
+  const __m256i lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)t->lo));
+  const __m256i hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)t->hi));
+  const __m256i mask = _mm256_set1_epi8(0x0f);
+  wi_t i = 0;
+  for(; i+4 <= n; i+=4) {
+    const __m256i x = _gf2e_split_avx2(_mm256_loadu_si256((const __m256i*)(b+i)), lo, hi, mask);
+    _mm256_storeu_si256((__m256i*)(c+i), _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(c+i)), x));
+  }
+  for(; i<n; i++)
+    c[i] ^= gf2e_split_word(t, b[i]);
+}
+
+__attribute__((target("avx2")))
+static void _gf2e_scale_row_avx2(word *c, const gf2e_split_t *t, const wi_t n) {
+  const __m256i lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)t->lo));
+  const __m256i hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)t->hi));
+  const __m256i mask = _mm256_set1_epi8(0x0f);
+  wi_t i = 0;
+  for(; i+4 <= n; i+=4) {
+    const __m256i x = _gf2e_split_avx2(_mm256_loadu_si256((const __m256i*)(c+i)), lo, hi, mask);
+    _mm256_storeu_si256((__m256i*)(c+i), x);
+  }
+  for(; i<n; i++)
+    c[i] = gf2e_split_word(t, c[i]);
+}
+
+#endif //HAVE_TARGET_AVX2
+
+#ifdef HAVE_TARGET_GFNI
+
+__attribute__((target("gfni,avx2")))
+static void _gf2e_addmul_row_gfni(word *c, const word *b, const gf2e_split_t *t, const wi_t n) {
+  const __m256i A = _mm256_set1_epi64x((long long)t->affine);
+  wi_t i = 0;
+  for(; i+4 <= n; i+=4) {
+    const __m256i x = _mm256_gf2p8affine_epi64_epi8(_mm256_loadu_si256((const __m256i*)(b+i)), A, 0);
+    _mm256_storeu_si256((__m256i*)(c+i), _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(c+i)), x));
+  }
+  for(; i<n; i++)
+    c[i] ^= gf2e_split_word(t, b[i]);
+}
+
+__attribute__((target("gfni,avx2")))
+static void _gf2e_scale_row_gfni(word *c, const gf2e_split_t *t, const wi_t n) {
+  const __m256i A = _mm256_set1_epi64x((long long)t->affine);
+  wi_t i = 0;
+  for(; i+4 <= n; i+=4) {
+    const __m256i x = _mm256_gf2p8affine_epi64_epi8(_mm256_loadu_si256((const __m256i*)(c+i)), A, 0);
+    _mm256_storeu_si256((__m256i*)(c+i), x);
+  }
+  for(; i<n; i++)
+    c[i] = gf2e_split_word(t, c[i]);
+}
+
+#endif //HAVE_TARGET_GFNI
+
+#ifdef HAVE_TARGET_PCLMUL
+
+__attribute__((target("pclmul")))
+static inline word _gf2e_clmul(const word a, const word b) {
+  const __m128i p = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)a), _mm_cvtsi64_si128((long long)b), 0x00);
+  return (word)_mm_cvtsi128_si64(p);
+}
+
+/**
+ * Reduce the products of degree < 2e stored in the 32-bit lanes of p modulo minpoly.
+ */
+
+__attribute__((target("pclmul")))
+static inline word _gf2e_barrett_pclmul(const word p, const gf2e *ff, const word mask_q) {
+  const deg_t e = ff->degree;
+  const word q = (_gf2e_clmul((p>>e) & mask_q, ff->_barrett)>>e) & mask_q;
+  return p ^ _gf2e_clmul(q, ff->minpoly);
+}
+
+__attribute__((target("pclmul")))
+static word _gf2e_mul_pclmul(const gf2e *ff, const word a, const word b) {
+  const word mask_q = __M4RI_LEFT_BITMASK(ff->degree - 1);
+  return _gf2e_barrett_pclmul(_gf2e_clmul(a, b), ff, mask_q);
+}
+
+/**
+ * Multiply the four 16-bit elements in b by a. Elements 0,2 and 1,3 are multiplied together since
+ * their products of at most 31 bits do not overlap if placed 32 bits apart.
+ */
+
+__attribute__((target("pclmul")))
+static inline word _gf2e_mul_word16_pclmul(const gf2e *ff, const word a, const word b) {
+  const word lanes  = 0x0000ffff0000ffffULL;
+  const word mask_q = __M4RI_LEFT_BITMASK(ff->degree - 1) * 0x0000000100000001ULL;
+  const word r0 = _gf2e_barrett_pclmul(_gf2e_clmul( b      & lanes, a), ff, mask_q);
+  const word r1 = _gf2e_barrett_pclmul(_gf2e_clmul((b>>16) & lanes, a), ff, mask_q);
+  return (r0 & lanes) | (r1 & lanes)<<16;
+}
+
+__attribute__((target("pclmul")))
+static void _gf2e_addmul_row_pclmul(word *c, const word *b, const gf2e_split_t *t, const wi_t n) {
+  for(wi_t i=0; i<n; i++)
+    c[i] ^= _gf2e_mul_word16_pclmul(t->ff, t->a, b[i]);
+}
+
+__attribute__((target("pclmul")))
+static void _gf2e_scale_row_pclmul(word *c, const gf2e_split_t *t, const wi_t n) {
+  for(wi_t i=0; i<n; i++)
+    c[i] = _gf2e_mul_word16_pclmul(t->ff, t->a, c[i]);
+}
+
+/**
+ * The product of (a0 + a2*x^32) and (b0 + b2*x^32) is a0*b0 + (a0*b2 + a2*b0)*x^32 + a2*b2*x^64, so
+ * summing the lowest and the third 32-bit lane of the 128-bit products gives the dot product, which
+ * is reduced once at the end.
+ */
+
+__attribute__((target("pclmul")))
+static word _gf2e_dot_row_pclmul(const gf2e *ff, const word *a, const word *b, const wi_t n) {
+  const __m128i lanes = _mm_set1_epi64x(0x0000ffff0000ffffLL);
+  __m128i acc = _mm_setzero_si128();
+  for(wi_t i=0; i<n; i++) {
+    const __m128i ai = _mm_cvtsi64_si128((long long)a[i]);
+    const __m128i bi = _mm_cvtsi64_si128((long long)b[i]);
+    const __m128i x = _mm_unpacklo_epi64(_mm_and_si128(ai, lanes), _mm_and_si128(_mm_srli_epi64(ai, 16), lanes));
+    const __m128i y = _mm_unpacklo_epi64(_mm_and_si128(bi, lanes), _mm_and_si128(_mm_srli_epi64(bi, 16), lanes));
+    acc = _mm_xor_si128(acc, _mm_clmulepi64_si128(x, y, 0x00));
+    acc = _mm_xor_si128(acc, _mm_clmulepi64_si128(x, y, 0x11));
+  }
+  const word p = ((word)_mm_cvtsi128_si64(acc) ^ (word)_mm_cvtsi128_si64(_mm_unpackhi_epi64(acc, acc))) & __M4RI_LEFT_BITMASK(32);
+  return _gf2e_barrett_pclmul(p, ff, __M4RI_LEFT_BITMASK(ff->degree - 1));
+}
+
+#endif //HAVE_TARGET_PCLMUL
+
+static unsigned int _gf2e_cpu_features_parse(const char *str) {
+  unsigned int features = 0;
+  char *buf = strdup(str);
+  for(char *tok = strtok(buf, ","); tok != NULL; tok = strtok(NULL, ",")) {
+    if (strcmp(tok, "ssse3") == 0)
+      features |= M4RIE_CPU_SSSE3;
+    else if (strcmp(tok, "avx2") == 0)
+      features |= M4RIE_CPU_AVX2;
+    else if (strcmp(tok, "gfni") == 0)
+      features |= M4RIE_CPU_GFNI;
+    else if (strcmp(tok, "pclmul") == 0)
+      features |= M4RIE_CPU_PCLMUL;
+    else if (strcmp(tok, "bmi2") == 0)
+      features |= M4RIE_CPU_BMI2;
+    else if (strcmp(tok, "portable") != 0)
+      m4ri_die("M4RIE_KERNELS: unknown feature '%s', expected 'portable', 'ssse3', 'avx2', 'gfni', 'pclmul' or 'bmi2'.\n", tok);
+  }
+  free(buf);
+  return features;
+}
+
+unsigned int gf2e_cpu_features(void) {
+  unsigned int features = 0;
+
+#if defined(HAVE_TARGET_SSSE3) || defined(HAVE_TARGET_AVX2) || defined(HAVE_TARGET_GFNI) || defined(HAVE_TARGET_PCLMUL) || defined(HAVE_TARGET_BMI2)
+  __builtin_cpu_init();
+#endif
+#ifdef HAVE_TARGET_SSSE3
+  if (__builtin_cpu_supports("ssse3"))
+    features |= M4RIE_CPU_SSSE3;
+#endif
+#ifdef HAVE_TARGET_AVX2
+  if (__builtin_cpu_supports("avx2"))
+    features |= M4RIE_CPU_AVX2;
+#endif
+#ifdef HAVE_TARGET_GFNI
+  if (__builtin_cpu_supports("gfni"))
+    features |= M4RIE_CPU_GFNI;
+#endif
+#ifdef HAVE_TARGET_PCLMUL
+  if (__builtin_cpu_supports("pclmul"))
+    features |= M4RIE_CPU_PCLMUL;
+#endif
+#ifdef HAVE_TARGET_BMI2
+  /* PEXT and PDEP are microcoded and slow on AMD CPUs before Zen 3 */
+  if (__builtin_cpu_supports("bmi2") && !__builtin_cpu_is("znver1") && !__builtin_cpu_is("znver2"))
+    features |= M4RIE_CPU_BMI2;
+#endif
+
+  const char *env = getenv("M4RIE_KERNELS");
+  if (env != NULL)
+    features &= _gf2e_cpu_features_parse(env);
+  return features;
+}
+
+static void _gf2e_select_conversion(gf2e_kernels_t *k, const deg_t degree, unsigned int features) {
+  switch(degree) {
+  case  2:
+    k->slice = _mzed_slice2;
+    k->cling = _mzed_cling2;
+    break;
+  case  3: case  4:
+    k->slice = _mzed_slice4;
+    k->cling = _mzed_cling4;
+    break;
+  case  5: case  6: case  7: case  8:
+    k->slice = _mzed_slice8;
+    k->cling = _mzed_cling8;
+    break;
+  case  9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+    k->slice = _mzed_slice16;
+    k->cling = _mzed_cling16;
+    break;
+  default:
+    m4ri_die("degree %d not supported.\n", degree);
+  }
+
+#ifdef HAVE_TARGET_BMI2
+  if (features & M4RIE_CPU_BMI2) {
+    k->slice = _mzed_slice_bmi2;
+    k->cling = _mzed_cling_bmi2;
+    k->features |= M4RIE_CPU_BMI2;
+  }
+#endif
+}
+
+void gf2e_select_kernels(gf2e *ff, unsigned int features) {
+  gf2e_kernels_t *k = &ff->kernels;
+  memset(k, 0, sizeof(gf2e_kernels_t));
+
+  k->dot_row = _gf2e_dot_row_bitsliced;
+
+  if (ff->degree > 8) {
+    ff->mul = (ff->_log != NULL) ? _gf2e_mul_log : _gf2e_mul_arith;
+#ifdef HAVE_TARGET_PCLMUL
+    if (features & M4RIE_CPU_PCLMUL) {
+      if (ff->_log == NULL)
+        ff->mul = _gf2e_mul_pclmul;
+      k->scale_row = _gf2e_scale_row_pclmul;
+      k->addmul_row = _gf2e_addmul_row_pclmul;
+      k->dot_row = _gf2e_dot_row_pclmul;
+      k->features = M4RIE_CPU_PCLMUL;
+    }
+#endif
+    _gf2e_select_conversion(k, ff->degree, features);
+    return;
+  }
+
+  k->scale_row = _gf2e_scale_row_table;
+  k->addmul_row = _gf2e_addmul_row_table;
+
+#ifdef HAVE_TARGET_SSSE3
+  if (features & M4RIE_CPU_SSSE3) {
+    k->scale_row = _gf2e_scale_row_ssse3;
+    k->addmul_row = _gf2e_addmul_row_ssse3;
+    k->features = M4RIE_CPU_SSSE3;
+  }
+#endif
+
+#ifdef HAVE_TARGET_AVX2
+  if (features & M4RIE_CPU_AVX2) {
+    k->scale_row = _gf2e_scale_row_avx2;
+    k->addmul_row = _gf2e_addmul_row_avx2;
+    k->features = M4RIE_CPU_AVX2;
+  }
+#endif
+
+#ifdef HAVE_TARGET_GFNI
+  if ((features & M4RIE_CPU_GFNI) && (features & M4RIE_CPU_AVX2)) {
+    k->scale_row = _gf2e_scale_row_gfni;
+    k->addmul_row = _gf2e_addmul_row_gfni;
+    k->features = M4RIE_CPU_GFNI | M4RIE_CPU_AVX2;
+  }
+#endif
+
+  _gf2e_select_conversion(k, ff->degree, features);
+}
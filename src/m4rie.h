@@ -83,6 +83,12 @@ extern "C" {
 #include <m4rie/conversion.h>
 #include <m4rie/permutation.h>
 #include <m4rie/mzd_poly.h>
+#include <m4rie/threads.h>
+#include <m4rie/workspace.h>
+#include <m4rie/mzed_lazy.h>
+#include <m4rie/profile.h>
+#include <m4rie/mul_plan.h>
+#include <m4rie/mzed_prepared.h>
 
 #ifdef __cplusplus
 }
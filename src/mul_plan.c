@@ -0,0 +1,328 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include "config.h"
+
+#include <time.h>
+#ifdef HAVE_OPENMP
+#include <omp.h>
+#endif
+
+#include "mul_plan.h"
+#include "conversion.h"
+#include "strassen.h"
+#include "profile.h"
+#include "threads.h"
+
+static m4rie_workspace_t **_m4rie_plan_workspaces(const int nthreads) {
+  m4rie_workspace_t **ws = (m4rie_workspace_t**)m4ri_mm_malloc(nthreads * sizeof(m4rie_workspace_t*));
+  for(int t=0; t<nthreads; t++)
+    ws[t] = m4rie_workspace_init(0, 0);
+  return ws;
+}
+
+static void _m4rie_plan_workspaces_free(m4rie_workspace_t **ws, const int nthreads) {
+  for(int t=0; t<nthreads; t++)
+    m4rie_workspace_free(ws[t]);
+  m4ri_mm_free(ws);
+}
+
+/**
+ * Return true if every thread of the parallel regions of an execution gets its own workspace.
+ *
+ * Threadprivate variables, such as the attached workspace, only persist between parallel regions
+ * with the same number of threads and if the OpenMP runtime may not change this number.
+ */
+
+static int _m4rie_plan_team(const int nthreads) {
+#ifdef HAVE_OPENMP
+  return (nthreads > 1 && nthreads == m4rie_get_num_threads() && !omp_in_parallel() && !omp_get_dynamic());
+#else
+  return 0;
+#endif
+}
+
+static void _m4rie_plan_attach(m4rie_workspace_t **ws, m4rie_workspace_t **saved, const int nthreads, const int team) {
+  if (!team) {
+    saved[0] = m4rie_workspace_attach(ws[0]);
+    return;
+  }
+#ifdef HAVE_OPENMP
+#pragma omp parallel num_threads(nthreads)
+  {
+    const int t = omp_get_thread_num();
+    saved[t] = m4rie_workspace_attach(ws[t]);
+  }
+#endif
+}
+
+static void _m4rie_plan_detach(m4rie_workspace_t **saved, const int nthreads, const int team) {
+  if (!team) {
+    m4rie_workspace_attach(saved[0]);
+    return;
+  }
+#ifdef HAVE_OPENMP
+#pragma omp parallel num_threads(nthreads)
+  m4rie_workspace_attach(saved[omp_get_thread_num()]);
+#endif
+}
+
+static double _m4rie_plan_walltime(void) {
+#ifdef HAVE_OPENMP
+  return omp_get_wtime();
+#else
+  return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+/**
+ * Fill A with random elements without touching the state of random(), which belongs to the
+ * caller.
+ */
+
+static void _m4rie_plan_randomize(mzed_t *A) {
+  const word bitmask = __M4RI_LEFT_BITMASK(A->finite_field->degree);
+  word x = 0x9e3779b97f4a7c15ULL;
+  for(rci_t i=0; i<A->nrows; i++) {
+    for(rci_t j=0; j<A->ncols; j++) {
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+      mzed_write_elem(A, i, j, x & bitmask);
+    }
+  }
+}
+
+/*
+ * mzed_t
+ */
+
+static mzed_t *_mzed_mul_plan_run(mzed_mul_plan_t *plan, mzed_t *C, const mzed_t *A, const mzed_t *B, const int addmul) {
+  const int team = _m4rie_plan_team(plan->nthreads);
+  _m4rie_plan_attach(plan->ws, plan->saved, plan->nthreads, team);
+
+  switch(plan->algorithm) {
+  case M4RIE_MUL_KARATSUBA:
+    if (addmul)
+      _mzed_addmul_karatsuba_tiled(C, A, B, plan->tile);
+    else
+      _mzed_mul_karatsuba_tiled(C, A, B, plan->tile);
+    break;
+  default:
+    if (addmul)
+      _mzed_addmul_strassen(C, A, B, plan->cutoff);
+    else
+      _mzed_mul_strassen(C, A, B, plan->cutoff);
+    break;
+  }
+
+  _m4rie_plan_detach(plan->saved, plan->nthreads, team);
+  return C;
+}
+
+mzed_mul_plan_t *mzed_mul_plan_init(const gf2e *ff, rci_t m, rci_t l, rci_t n, int flags) {
+  mzed_mul_plan_t *plan = (mzed_mul_plan_t*)m4ri_mm_calloc(1, sizeof(mzed_mul_plan_t));
+  plan->finite_field = ff;
+  plan->m = m;
+  plan->l = l;
+  plan->n = n;
+  plan->nthreads = m4rie_get_num_threads();
+  plan->ws = _m4rie_plan_workspaces(plan->nthreads);
+  plan->saved = (m4rie_workspace_t**)m4ri_mm_calloc(plan->nthreads, sizeof(m4rie_workspace_t*));
+
+  mzed_t *A = mzed_init(ff, m, l);
+  mzed_t *B = mzed_init(ff, l, n);
+  mzed_t *C = mzed_init(ff, m, n);
+
+  plan->cutoff = _mzed_strassen_cutoff(C, A, B);
+  plan->tile = __M4RIE_KARATSUBA_TILE;
+
+  if (flags & M4RIE_PLAN_MEASURE) {
+    const m4rie_mul_algorithm_t candidates[2] = {M4RIE_MUL_STRASSEN, M4RIE_MUL_KARATSUBA};
+    _m4rie_plan_randomize(A);
+    _m4rie_plan_randomize(B);
+
+    int choice = 0;
+    double best = 0.0;
+    for(int i=0; i<2; i++) {
+      plan->algorithm = candidates[i];
+      /* the first run fills the workspaces, the second one is timed */
+      _mzed_mul_plan_run(plan, C, A, B, 0);
+      double t = _m4rie_plan_walltime();
+      _mzed_mul_plan_run(plan, C, A, B, 0);
+      t = _m4rie_plan_walltime() - t;
+      if (i == 0 || t < best) {
+        best = t;
+        choice = i;
+      }
+    }
+    plan->algorithm = candidates[choice];
+  } else {
+    plan->algorithm = m4rie_profile_use_karatsuba(ff, m, l, n) ? M4RIE_MUL_KARATSUBA : M4RIE_MUL_STRASSEN;
+    _mzed_mul_plan_run(plan, C, A, B, 0);
+  }
+  /* C = C + A*B may need other temporaries than C = A*B */
+  _mzed_mul_plan_run(plan, C, A, B, 1);
+
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(C);
+  return plan;
+}
+
+void mzed_mul_plan_free(mzed_mul_plan_t *plan) {
+  _m4rie_plan_workspaces_free(plan->ws, plan->nthreads);
+  m4ri_mm_free(plan->saved);
+  m4ri_mm_free(plan);
+}
+
+static void _mzed_mul_plan_check(const mzed_mul_plan_t *plan, const mzed_t *C, const mzed_t *A, const mzed_t *B) {
+  if (A->finite_field != plan->finite_field || B->finite_field != plan->finite_field || C->finite_field != plan->finite_field)
+    m4ri_die("mzed_mul_execute: fields must match the plan.\n");
+  if (A->nrows != plan->m || A->ncols != plan->l || B->nrows != plan->l || B->ncols != plan->n)
+    m4ri_die("mzed_mul_execute: rows and columns must match the plan.\n");
+  if (C->nrows != plan->m || C->ncols != plan->n)
+    m4ri_die("mzed_mul_execute: rows and columns of returned matrix must match the plan.\n");
+}
+
+mzed_t *mzed_mul_execute(mzed_mul_plan_t *plan, mzed_t *C, const mzed_t *A, const mzed_t *B) {
+  _mzed_mul_plan_check(plan, C, A, B);
+  return _mzed_mul_plan_run(plan, C, A, B, 0);
+}
+
+mzed_t *mzed_addmul_execute(mzed_mul_plan_t *plan, mzed_t *C, const mzed_t *A, const mzed_t *B) {
+  _mzed_mul_plan_check(plan, C, A, B);
+  return _mzed_mul_plan_run(plan, C, A, B, 1);
+}
+
+/*
+ * mzd_slice_t
+ */
+
+static mzd_slice_t *_mzd_slice_mul_plan_run(mzd_slice_mul_plan_t *plan, mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B, const int addmul) {
+  const int team = _m4rie_plan_team(plan->nthreads);
+  _m4rie_plan_attach(plan->ws, plan->saved, plan->nthreads, team);
+
+  switch(plan->algorithm) {
+  case M4RIE_MUL_BLM:
+    if (addmul) {
+      mzd_slice_t *T = _mzd_slice_init_scratch(plan->finite_field, C->nrows, C->ncols);
+      _mzd_slice_mul_blm(T, A, B, plan->f);
+      mzd_slice_add(C, C, T);
+      _mzd_slice_free_scratch(T);
+    } else {
+      mzd_slice_set_ui(C, 0);
+      _mzd_slice_mul_blm(C, A, B, plan->f);
+    }
+    break;
+  default:
+    if (!addmul)
+      mzd_slice_set_ui(C, 0);
+    _mzd_slice_addmul_karatsuba(C, A, B);
+    break;
+  }
+
+  _m4rie_plan_detach(plan->saved, plan->nthreads, team);
+  return C;
+}
+
+mzd_slice_mul_plan_t *mzd_slice_mul_plan_init(const gf2e *ff, rci_t m, rci_t l, rci_t n, int flags) {
+  mzd_slice_mul_plan_t *plan = (mzd_slice_mul_plan_t*)m4ri_mm_calloc(1, sizeof(mzd_slice_mul_plan_t));
+  plan->finite_field = ff;
+  plan->m = m;
+  plan->l = l;
+  plan->n = n;
+  plan->nthreads = m4rie_get_num_threads();
+  plan->ws = _m4rie_plan_workspaces(plan->nthreads);
+  plan->saved = (m4rie_workspace_t**)m4ri_mm_calloc(plan->nthreads, sizeof(m4rie_workspace_t*));
+
+  mzd_slice_t *A = mzd_slice_init(ff, m, l);
+  mzd_slice_t *B = mzd_slice_init(ff, l, n);
+  mzd_slice_t *C = mzd_slice_init(ff, m, n);
+
+  if (flags & M4RIE_PLAN_MEASURE) {
+    const m4rie_mul_algorithm_t candidates[2] = {M4RIE_MUL_KARATSUBA, M4RIE_MUL_BLM};
+    mzed_t *T = mzed_init(ff, m, l);
+    _m4rie_plan_randomize(T);
+    mzed_slice(A, T);
+    mzed_free(T);
+    T = mzed_init(ff, l, n);
+    _m4rie_plan_randomize(T);
+    mzed_slice(B, T);
+    mzed_free(T);
+
+    plan->f = blm_cache_get_field(ff);
+
+    int choice = 0;
+    double best = 0.0;
+    for(int i=0; i<2; i++) {
+      plan->algorithm = candidates[i];
+      /* the first run fills the workspaces, the second one is timed */
+      _mzd_slice_mul_plan_run(plan, C, A, B, 0);
+      double t = _m4rie_plan_walltime();
+      _mzd_slice_mul_plan_run(plan, C, A, B, 0);
+      t = _m4rie_plan_walltime() - t;
+      if (i == 0 || t < best) {
+        best = t;
+        choice = i;
+      }
+    }
+    plan->algorithm = candidates[choice];
+  } else {
+    if (m4rie_profile_use_blm(ff, m, l, n)) {
+      plan->algorithm = M4RIE_MUL_BLM;
+      plan->f = blm_cache_get_field(ff);
+    } else {
+      plan->algorithm = M4RIE_MUL_KARATSUBA;
+    }
+    _mzd_slice_mul_plan_run(plan, C, A, B, 0);
+  }
+  /* C = C + A*B may need other temporaries than C = A*B */
+  _mzd_slice_mul_plan_run(plan, C, A, B, 1);
+
+  mzd_slice_free(A);
+  mzd_slice_free(B);
+  mzd_slice_free(C);
+  return plan;
+}
+
+void mzd_slice_mul_plan_free(mzd_slice_mul_plan_t *plan) {
+  _m4rie_plan_workspaces_free(plan->ws, plan->nthreads);
+  m4ri_mm_free(plan->saved);
+  m4ri_mm_free(plan);
+}
+
+static void _mzd_slice_mul_plan_check(const mzd_slice_mul_plan_t *plan, const mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B) {
+  if (A->finite_field != plan->finite_field || B->finite_field != plan->finite_field || C->finite_field != plan->finite_field)
+    m4ri_die("mzd_slice_mul_execute: fields must match the plan.\n");
+  if (A->nrows != plan->m || A->ncols != plan->l || B->nrows != plan->l || B->ncols != plan->n)
+    m4ri_die("mzd_slice_mul_execute: rows and columns must match the plan.\n");
+  if (C->nrows != plan->m || C->ncols != plan->n)
+    m4ri_die("mzd_slice_mul_execute: rows and columns of returned matrix must match the plan.\n");
+}
+
+mzd_slice_t *mzd_slice_mul_execute(mzd_slice_mul_plan_t *plan, mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B) {
+  _mzd_slice_mul_plan_check(plan, C, A, B);
+  return _mzd_slice_mul_plan_run(plan, C, A, B, 0);
+}
+
+mzd_slice_t *mzd_slice_addmul_execute(mzd_slice_mul_plan_t *plan, mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B) {
+  _mzd_slice_mul_plan_check(plan, C, A, B);
+  return _mzd_slice_mul_plan_run(plan, C, A, B, 1);
+}
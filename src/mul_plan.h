@@ -0,0 +1,208 @@
+/**
+ * \file mul_plan.h
+ * \brief Multiplication plans for repeated products of the same shape.
+ *
+ * mzed_mul() and mzd_slice_mul() pick an algorithm, compute its parameters and allocate all
+ * temporaries on every call. A plan does this once for products of an m x l by an l x n matrix
+ * over a fixed field: it fixes the algorithm and its parameters, fetches the bilinear map if one
+ * is needed and owns the workspaces (see workspace.h) from which all temporaries are taken.
+ *
+ * When a plan is created the chosen algorithm is run on matrices of the planned shape, so that
+ * its workspaces hold all temporaries of later executions. Executing the plan then does not
+ * allocate any matrices. Small bookkeeping structures such as window headers and Newton-John
+ * tables are still allocated as usual.
+ *
+ * If the plan uses several threads, every thread takes its temporaries from its own workspace
+ * of the plan. Which thread ends up with which part of the work may vary between executions, so
+ * a workspace may still grow during the first few executions until it holds the largest demand
+ * seen.
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_MUL_PLAN_H
+#define M4RIE_MUL_PLAN_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <m4ri/m4ri.h>
+#include <m4rie/gf2e.h>
+#include <m4rie/mzed.h>
+#include <m4rie/mzd_slice.h>
+#include <m4rie/blm.h>
+#include <m4rie/workspace.h>
+
+/**
+ * \brief Pick the algorithm like mzed_mul() and mzd_slice_mul() do, see profile.h.
+ */
+
+#define M4RIE_PLAN_ESTIMATE 0x0
+
+/**
+ * \brief Pick the algorithm by timing all candidates on random matrices of the planned shape.
+ */
+
+#define M4RIE_PLAN_MEASURE  0x1
+
+/**
+ * \brief Algorithms a plan may execute.
+ */
+
+typedef enum {
+  M4RIE_MUL_STRASSEN,  /**< Strassen-Winograd on top of Newton-John tables, see _mzed_mul_strassen(). */
+  M4RIE_MUL_KARATSUBA, /**< Karatsuba on bitsliced tiles or matrices, see _mzed_mul_karatsuba_tiled(). */
+  M4RIE_MUL_BLM,       /**< Bilinear maps on bitsliced matrices, see _mzd_slice_mul_blm(). */
+} m4rie_mul_algorithm_t;
+
+/**
+ * \brief Plan for C = A*B or C = C + A*B with A an m x l and B an l x n matrix over a fixed field.
+ */
+
+typedef struct {
+  const gf2e *finite_field;        /**< Finite field of all operands. */
+  rci_t m;                         /**< Number of rows of A and C. */
+  rci_t l;                         /**< Number of columns of A and rows of B. */
+  rci_t n;                         /**< Number of columns of B and C. */
+  m4rie_mul_algorithm_t algorithm; /**< M4RIE_MUL_STRASSEN or M4RIE_MUL_KARATSUBA. */
+  rci_t cutoff;                    /**< Cutoff of Strassen-Winograd. */
+  rci_t tile;                      /**< Tile size of Karatsuba. */
+  int nthreads;                    /**< Number of threads with a workspace below. */
+  m4rie_workspace_t **ws;          /**< One workspace per thread. */
+  m4rie_workspace_t **saved;       /**< Workspaces attached before an execution. */
+} mzed_mul_plan_t;
+
+/**
+ * \brief Plan for C = A*B or C = C + A*B with A an m x l and B an l x n bitsliced matrix over a
+ * fixed field.
+ */
+
+typedef struct {
+  const gf2e *finite_field;        /**< Finite field of all operands. */
+  rci_t m;                         /**< Number of rows of A and C. */
+  rci_t l;                         /**< Number of columns of A and rows of B. */
+  rci_t n;                         /**< Number of columns of B and C. */
+  m4rie_mul_algorithm_t algorithm; /**< M4RIE_MUL_KARATSUBA or M4RIE_MUL_BLM. */
+  const blm_t *f;                  /**< Bilinear map from blm_cache_get_field() or NULL. */
+  int nthreads;                    /**< Number of threads with a workspace below. */
+  m4rie_workspace_t **ws;          /**< One workspace per thread. */
+  m4rie_workspace_t **saved;       /**< Workspaces attached before an execution. */
+} mzd_slice_mul_plan_t;
+
+/**
+ * \brief Create a plan for products of an m x l by an l x n matrix over ff.
+ *
+ * \param ff Finite field.
+ * \param m Number of rows of A.
+ * \param l Number of columns of A.
+ * \param n Number of columns of B.
+ * \param flags M4RIE_PLAN_ESTIMATE or M4RIE_PLAN_MEASURE.
+ *
+ * \note The plan uses up to m4rie_get_num_threads() threads as set at the time of this call.
+ *
+ * \sa mzed_mul_execute() mzed_mul_plan_free()
+ */
+
+mzed_mul_plan_t *mzed_mul_plan_init(const gf2e *ff, rci_t m, rci_t l, rci_t n, int flags);
+
+/**
+ * \brief Free a plan.
+ *
+ * \param plan Plan.
+ */
+
+void mzed_mul_plan_free(mzed_mul_plan_t *plan);
+
+/**
+ * \brief \f$C = A \cdot B\f$ as planned.
+ *
+ * \param plan Plan matching the dimensions and field of A and B.
+ * \param C Preallocated product matrix.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ *
+ * \warning A plan must not be executed by several threads at the same time.
+ */
+
+mzed_t *mzed_mul_execute(mzed_mul_plan_t *plan, mzed_t *C, const mzed_t *A, const mzed_t *B);
+
+/**
+ * \brief \f$C = C + A \cdot B\f$ as planned.
+ *
+ * \param plan Plan matching the dimensions and field of A and B.
+ * \param C Preallocated product matrix.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ *
+ * \warning A plan must not be executed by several threads at the same time.
+ */
+
+mzed_t *mzed_addmul_execute(mzed_mul_plan_t *plan, mzed_t *C, const mzed_t *A, const mzed_t *B);
+
+/**
+ * \brief Create a plan for products of an m x l by an l x n bitsliced matrix over ff.
+ *
+ * \param ff Finite field.
+ * \param m Number of rows of A.
+ * \param l Number of columns of A.
+ * \param n Number of columns of B.
+ * \param flags M4RIE_PLAN_ESTIMATE or M4RIE_PLAN_MEASURE.
+ *
+ * \note The plan uses up to m4rie_get_num_threads() threads as set at the time of this call.
+ *
+ * \sa mzd_slice_mul_execute() mzd_slice_mul_plan_free()
+ */
+
+mzd_slice_mul_plan_t *mzd_slice_mul_plan_init(const gf2e *ff, rci_t m, rci_t l, rci_t n, int flags);
+
+/**
+ * \brief Free a plan.
+ *
+ * \param plan Plan.
+ */
+
+void mzd_slice_mul_plan_free(mzd_slice_mul_plan_t *plan);
+
+/**
+ * \brief \f$C = A \cdot B\f$ as planned.
+ *
+ * \param plan Plan matching the dimensions and field of A and B.
+ * \param C Preallocated product matrix.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ *
+ * \warning A plan must not be executed by several threads at the same time.
+ */
+
+mzd_slice_t *mzd_slice_mul_execute(mzd_slice_mul_plan_t *plan, mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B);
+
+/**
+ * \brief \f$C = C + A \cdot B\f$ as planned.
+ *
+ * \param plan Plan matching the dimensions and field of A and B.
+ * \param C Preallocated product matrix.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ *
+ * \warning A plan must not be executed by several threads at the same time.
+ */
+
+mzd_slice_t *mzd_slice_addmul_execute(mzd_slice_mul_plan_t *plan, mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B);
+
+#endif //M4RIE_MUL_PLAN_H
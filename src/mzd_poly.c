@@ -49,7 +49,7 @@ mzd_poly_t *_mzd_poly_addmul_ext1(mzd_poly_t *C, mzd_poly_t *A, mzd_poly_t *B) {
       mzed_write_elem(Phi, i, j, acc);
       if (j < A->depth) mzd_slice_addmul_mzd(a, acc, A->x[j]);
       if (j < B->depth) mzd_slice_addmul_mzd(b, acc, B->x[j]);
-      acc = ff->mul(ff, alpha, acc);
+      acc = gf2e_mul(ff, alpha, acc);
     }
     c[i] = mzd_slice_mul(NULL, a, b);
   }
@@ -223,12 +223,8 @@ static inline mzd_poly_t *_mzd_poly_addmul_blm(mzd_poly_t *C, mzd_poly_t *A, mzd
  */
 
 static inline mzd_poly_t *_mzd_poly_addmul_crt(mzd_poly_t *C, mzd_poly_t *A, mzd_poly_t *B) {
-  int *p = crt_init(A->depth, B->depth);
-  blm_t *f = blm_init_crt(NULL, A->depth, B->depth, p, 1);
-  _mzd_poly_addmul_blm(C, A, B, f);
-  blm_free(f);
-  m4ri_mm_free(p);
-  return C;
+  const blm_t *f = blm_cache_get_crt(A->depth, B->depth);
+  return _mzd_poly_addmul_blm(C, A, B, f);
 }
 
 /**
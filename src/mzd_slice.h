@@ -39,6 +39,7 @@
 #include <m4rie/mzd_poly.h>
 #include <m4rie/mzed.h>
 #include <m4rie/blm.h>
+#include <m4rie/profile.h>
 
 /**
  * \brief Dense matrices over \GF2E represented as slices of matrices over \GF2.
@@ -53,7 +54,7 @@
  * \ingroup Definitions
  */
 
-typedef struct {
+typedef struct mzd_slice_struct {
   mzd_t *x[16]; /**< mzd_slice_t::x[e][i,j] is the \e-th bit of the entry A[i,j]. */
   rci_t nrows; /**< Number of rows. */
   rci_t ncols; /**< Number of columns. */
@@ -696,35 +697,21 @@ static inline mzd_slice_t *mzd_slice_addmul_karatsuba(mzd_slice_t *C, const mzd_
  * \param C Preallocated return matrix, may be NULL for automatic creation.
  * \param A Input matrix A.
  * \param B Input matrix B.
- * \param f Blinear map such that C == H*((F*A) x (G*B)), if NULL it will be created and destroyed
+ * \param f Blinear map such that C == H*((F*A) x (G*B)), if NULL the cached map for the field is used (see blm_cache_get_field())
  *
  * \ingroup Multiplication
  *
  * \note Calling _mzd_slice_addmul_karatsuba will be more efficient
  */
 
-static inline mzd_slice_t *_mzd_slice_mul_blm(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B, blm_t *f) {  
+static inline mzd_slice_t *_mzd_slice_mul_blm(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B, const blm_t *f) {
   if (C == NULL)
     C = mzd_slice_init(A->finite_field, A->nrows, B->ncols);
 
-  int free_f = 0;
-
-  if (f == NULL) {
-    const deg_t d = C->finite_field->degree;
-    if (d > 16) 
-      m4ri_die("degrees > 16 unsupported.\n");
-    int *p = (int *)m4ri_mm_calloc(M4RIE_MAX_DEGREE+1, sizeof(int));
-    p[d] = 1;
-    free_f = 1;
-    f = blm_init_crt(C->finite_field, d, d, p, 1);
-    m4ri_mm_free(p);
-  }
+  const blm_t *g = (f != NULL) ? f : blm_cache_get_field(C->finite_field);
 
-  _mzd_ptr_apply_blm(C->x, (const mzd_t**)A->x, (const mzd_t**)B->x, f);
+  _mzd_ptr_apply_blm(C->x, (const mzd_t**)A->x, (const mzd_t**)B->x, g);
 
-  if (free_f)
-    blm_free(f);
-  
   return C;
 }
 
@@ -734,14 +721,14 @@ static inline mzd_slice_t *_mzd_slice_mul_blm(mzd_slice_t *C, const mzd_slice_t
  * \param C Preallocated return matrix, may be NULL for automatic creation.
  * \param A Input matrix A.
  * \param B Input matrix B.
- * \param f Blinear map such that C == H*((F*A) x (G*B)), if NULL it will be created and destroyed
+ * \param f Blinear map such that C == H*((F*A) x (G*B)), if NULL the cached map for the field is used (see blm_cache_get_field())
  *
  * \ingroup Multiplication
  *
  * \note Calling mzd_slice_mul_karatsuba will be more efficient
  */
 
-static inline mzd_slice_t *mzd_slice_mul_blm(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B, blm_t *f) {
+static inline mzd_slice_t *mzd_slice_mul_blm(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B, const blm_t *f) {
   if (A->ncols != B->nrows || A->finite_field != B->finite_field)
     m4ri_die("mzd_slice_mul_karatsuba: rows, columns and fields must match.\n");
   if (C != NULL) {
@@ -758,14 +745,14 @@ static inline mzd_slice_t *mzd_slice_mul_blm(mzd_slice_t *C, const mzd_slice_t *
  * \param C Preallocated return matrix, may be NULL for automatic creation.
  * \param A Input matrix A.
  * \param B Input matrix B.
- * \param f Blinear map such that C == C + H*((F*A) x (G*B)), if NULL it will be created and destroyed
+ * \param f Blinear map such that C == C + H*((F*A) x (G*B)), if NULL the cached map for the field is used (see blm_cache_get_field())
  *
  * \ingroup Multiplication
  *
  * \note Calling mzd_slice_addmul_karatsuba will be more efficient
  */
 
-static inline mzd_slice_t *mzd_slice_addmul_blm(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B, blm_t *f) {
+static inline mzd_slice_t *mzd_slice_addmul_blm(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B, const blm_t *f) {
   assert(C != NULL);
   if (A->ncols != B->nrows || A->finite_field != B->finite_field)
     m4ri_die("mzd_slice_addmul_karatsuba: rows, columns and fields must match.\n");
@@ -803,6 +790,25 @@ mzd_slice_t *mzd_slice_mul_scalar(mzd_slice_t *C, const word a, const mzd_slice_
 mzd_slice_t *mzd_slice_addmul_scalar(mzd_slice_t *C, const word a, const mzd_slice_t *B);
 
 
+/**
+ * \brief \f$ C = C + A \cdot B \f$ using Karatsuba or bilinear maps, see m4rie_profile_use_blm().
+ *
+ * \param C Preallocated return matrix.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ *
+ * \ingroup Multiplication
+ */
+
+static inline mzd_slice_t *_mzd_slice_addmul(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B) {
+  if (!m4rie_profile_use_blm(A->finite_field, A->nrows, A->ncols, B->ncols))
+    return _mzd_slice_addmul_karatsuba(C, A, B);
+  mzd_slice_t *T = _mzd_slice_mul_blm(NULL, A, B, NULL);
+  mzd_slice_add(C, C, T);
+  mzd_slice_free(T);
+  return C;
+}
+
 /**
  * \brief \f$ C = A \cdot B \f$.
  *
@@ -810,12 +816,14 @@ mzd_slice_t *mzd_slice_addmul_scalar(mzd_slice_t *C, const word a, const mzd_sli
  * \param A Input matrix A.
  * \param B Input matrix B.
  *
- * \sa _mzd_slice_addmul_karatsuba()
+ * \sa _mzd_slice_addmul_karatsuba() m4rie_profile_use_blm()
  *
  * \ingroup Multiplication
  */
 
 static inline mzd_slice_t *mzd_slice_mul(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B) {
+  if (m4rie_profile_use_blm(A->finite_field, A->nrows, A->ncols, B->ncols))
+    return mzd_slice_mul_blm(C,A,B,NULL);
   return mzd_slice_mul_karatsuba(C,A,B);
 }
 
@@ -826,12 +834,14 @@ static inline mzd_slice_t *mzd_slice_mul(mzd_slice_t *C, const mzd_slice_t *A, c
  * \param A Input matrix A.
  * \param B Input matrix B.
  *
- * \sa _mzd_slice_addmul_karatsuba(n)
+ * \sa _mzd_slice_addmul_karatsuba() m4rie_profile_use_blm()
  *
  * \ingroup Multiplication
  */
 
 static inline mzd_slice_t *mzd_slice_addmul(mzd_slice_t *C, const mzd_slice_t *A, const mzd_slice_t *B) {
+  if (m4rie_profile_use_blm(A->finite_field, A->nrows, A->ncols, B->ncols))
+    return mzd_slice_addmul_blm(C,A,B,NULL);
   return mzd_slice_addmul_karatsuba(C,A,B);
 }
 
@@ -100,16 +100,16 @@ mzed_t *mzed_addmul(mzed_t *C, const mzed_t *A, const mzed_t *B) {
 }
 
 mzed_t *_mzed_mul(mzed_t *C, const mzed_t *A, const mzed_t *B) {
-  if (A->nrows >= 512 && A->ncols >= 512 && B->ncols >= 512)
-    return _mzed_addmul_karatsuba(C, A, B);
+  if (m4rie_profile_use_karatsuba(A->finite_field, A->nrows, A->ncols, B->ncols))
+    return _mzed_mul_karatsuba_tiled(C, A, B, __M4RIE_KARATSUBA_TILE);
 
   const rci_t cutoff = _mzed_strassen_cutoff(C, A, B);
   return _mzed_mul_strassen(C, A, B, cutoff);
 }
 
 mzed_t *_mzed_addmul(mzed_t *C, const mzed_t *A, const mzed_t *B) {
-  if (A->nrows >= 512 && A->ncols >= 512 && B->ncols >= 512)
-    return _mzed_addmul_karatsuba(C, A, B);
+  if (m4rie_profile_use_karatsuba(A->finite_field, A->nrows, A->ncols, B->ncols))
+    return _mzed_addmul_karatsuba_tiled(C, A, B, __M4RIE_KARATSUBA_TILE);
 
   const rci_t cutoff = _mzed_strassen_cutoff(C, A, B);
   return _mzed_addmul_strassen(C, A, B, cutoff);
@@ -130,7 +130,7 @@ mzed_t *_mzed_mul_naive(mzed_t *C, const mzed_t *A, const mzed_t *B) {
   for (rci_t i=0; i<C->nrows; ++i) {
     for (rci_t j=0; j<C->ncols; ++j) {
       for (rci_t k=0; k<A->ncols; ++k) {
-        mzed_add_elem(C, i, j, ff->mul(ff, mzed_read_elem(A,i, k), mzed_read_elem(B, k, j)));
+        mzed_add_elem(C, i, j, gf2e_mul(ff, mzed_read_elem(A,i, k), mzed_read_elem(B, k, j)));
       }
     }
   }
@@ -151,7 +151,7 @@ mzed_t *mzed_mul_scalar(mzed_t *C, const word a, const mzed_t *B) {
    * 0) If a direct approach would need less lookups we use that.
    */
 
-  if(ff->degree > 8 || B->nrows*B->ncols < 1<<17) {
+  if(B->nrows*B->ncols < 1<<17) {
     mzed_copy(C, B);
     for(rci_t i=0; i<B->nrows; i++)
       mzed_rescale_row(C, i, 0, a);
@@ -159,36 +159,32 @@ mzed_t *mzed_mul_scalar(mzed_t *C, const word a, const mzed_t *B) {
   }
 
   /**
-   * 1) We generate a lookup table of 16-bit wide entries
+   * 1) We fetch a lookup table of 16-bit wide entries, it is cached by the field.
    */
-  const word mask_16 = (1<<16)-1;
-  const word *mul = (const word*)gf2e_t16_init(B->finite_field, a);
+  const gf2e_t16_t *t = gf2e_t16_get(ff, a);
 
   /**
-   * 2) We use that lookup table to do 4 lookups per word
+   * 2) We use that lookup table to do 4 lookups per word, or 8 lookups of 8-bit halves of
+   * elements for e > 8.
    */
 
+  const wi_t width = C->x->width;
+  const word mask_end = B->x->high_bitmask;
+
   for(rci_t i=0; i<C->nrows; i++) {
     word *c_row = C->x->rows[i];
     const word *b_row = B->x->rows[i];
-    for(wi_t j=0; j<C->x->width-1; j++) {
-      const word tmp = b_row[j];
-      const word a0 = tmp & mask_16;
-      const word a1 = tmp>>16 & mask_16;
-      const word a2 = tmp>>32 & mask_16;
-      const word a3 = tmp>>48 & mask_16;
-      c_row[j] = mul[a3]<<48 | mul[a2]<<32 | mul[a1]<<16 | mul[a0];      
+    if (ff->degree <= 8) {
+      for(wi_t j=0; j<width-1; j++)
+        c_row[j] = gf2e_t16_mul_word(t, b_row[j]);
+      c_row[width-1] = (c_row[width-1] & ~mask_end) | gf2e_t16_mul_word(t, b_row[width-1] & mask_end);
+    } else {
+      for(wi_t j=0; j<width-1; j++)
+        c_row[j] = gf2e_t16_mul_word16(t, b_row[j]);
+      c_row[width-1] = (c_row[width-1] & ~mask_end) | gf2e_t16_mul_word16(t, b_row[width-1] & mask_end);
     }
-    /* deal with rest */
-    const word tmp = b_row[B->x->width-1] & B->x->high_bitmask;
-    const word a0 = tmp & mask_16;
-    const word a1 = tmp>>16 & mask_16;
-    const word a2 = tmp>>32 & mask_16;
-    const word a3 = tmp>>48 & mask_16;
-    c_row[C->x->width-1] &= ~B->x->high_bitmask;
-    c_row[C->x->width-1] |= mul[a3]<<48 | mul[a2]<<32 | mul[a1]<<16 | mul[a0];
   }
-  gf2e_t16_free((word*)mul);
+  gf2e_t16_release(ff, t);
   return C;
 }
 
@@ -215,30 +211,30 @@ rci_t mzed_echelonize_naive(mzed_t *A, int full) {
   const gf2e *ff = A->finite_field;
 
   start_row = 0;
+  rci_t *first = (rci_t*)m4ri_mm_calloc(nr, sizeof(rci_t));
 
   for(c=0; c<nc; c++) {
-    for(r=start_row; r<nr; r++) {
-      x = mzed_read_elem(A, r, c);
-      if (x) {
-        mzed_rescale_row(A, r, c, gf2e_inv(ff, x));
-        mzd_row_swap(A->x, r, start_row);
-        if (full)
-          elim_start = 0;
-        else
-          elim_start = start_row + 1;
-        for(i=elim_start; i<nr; i++) {
-          if (i==start_row) 
-            continue;
-          x = mzed_read_elem(A,i,c);
-          if(!x) continue;
-          /* clear row */
-          mzed_add_multiple_of_row(A, i, A, start_row, x, c);
-        }
-        start_row++;
-        break;
-      }
+    if (!mzed_find_pivot(A, start_row, c, nc, first, &r, &c))
+      break;
+    x = mzed_read_elem(A, r, c);
+    mzed_rescale_row(A, r, c, gf2e_inv(ff, x));
+    mzd_row_swap(A->x, r, start_row);
+    first[r] = first[start_row]; /* start_row is not searched again */
+    if (full)
+      elim_start = 0;
+    else
+      elim_start = start_row + 1;
+    for(i=elim_start; i<nr; i++) {
+      if (i==start_row) 
+        continue;
+      x = mzed_read_elem(A,i,c);
+      if(!x) continue;
+      /* clear row */
+      mzed_add_multiple_of_row(A, i, A, start_row, x, c);
     }
+    start_row++;
   }
+  m4ri_mm_free(first);
   return start_row;
 }
 
@@ -269,6 +265,74 @@ void mzed_print(const mzed_t *A) {
   }
 }
 
+word mzed_row_dot(const mzed_t *A, rci_t ar, const mzed_t *B, rci_t br) {
+  assert(A->ncols == B->ncols && A->finite_field == B->finite_field);
+
+  const gf2e *ff = A->finite_field;
+  const wi_t width = A->x->width;
+
+  if (width == 0)
+    return 0;
+
+  const word *a = A->x->rows[ar];
+  const word *b = B->x->rows[br];
+  const word a_end = a[width-1] & A->x->high_bitmask;
+  const word b_end = b[width-1] & B->x->high_bitmask;
+
+  return ff->kernels.dot_row(ff, a, b, width-1) ^ ff->kernels.dot_row(ff, &a_end, &b_end, 1);
+}
+
+rci_t mzed_first_nonzero_in_row(const mzed_t *A, rci_t r, rci_t start_col, rci_t stop_col) {
+  if (start_col >= stop_col)
+    return stop_col;
+
+  const word *a = A->x->rows[r];
+  const rci_t start = A->w*start_col;
+  const rci_t stop = A->w*stop_col;
+  const wi_t last = (stop - 1) / m4ri_radix;
+  wi_t j = start / m4ri_radix;
+
+  word v = a[j] & __M4RI_RIGHT_BITMASK(m4ri_radix - (start%m4ri_radix));
+  while (v == 0 && j < last)
+    v = a[++j];
+  if (j == last)
+    v &= __M4RI_LEFT_BITMASK((stop - 1) % m4ri_radix + 1);
+  if (v == 0)
+    return stop_col;
+
+  rci_t c = (j*m4ri_radix) / A->w;
+  const word mask = __M4RI_LEFT_BITMASK(A->w);
+  while ((v & mask) == 0) {
+    v >>= A->w;
+    c++;
+  }
+  return c;
+}
+
+int mzed_find_pivot(const mzed_t *A, rci_t start_row, rci_t start_col, rci_t stop_col, rci_t *first, rci_t *r, rci_t *c) {
+  rci_t best = stop_col;
+
+  /* a row with a non-zero entry in start_col cannot be beaten by the rows below it */
+  for(rci_t i=start_row; i<A->nrows && best > start_col; i++) {
+    rci_t lo = start_col;
+    if (first && first[i] > lo)
+      lo = first[i];
+    if (lo >= best)
+      continue;
+    const rci_t f = mzed_first_nonzero_in_row(A, i, lo, best);
+    if (first)
+      first[i] = f;
+    if (f < best) {
+      best = f;
+      *r = i;
+    }
+  }
+  if (best == stop_col)
+    return 0;
+  *c = best;
+  return 1;
+}
+
 void mzed_add_multiple_of_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br, word x, rci_t start_col) {
   assert(A->ncols == B->ncols && A->finite_field == B->finite_field);
   assert(start_col < A->ncols);
@@ -292,43 +356,63 @@ void mzed_add_multiple_of_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br, wo
   word *_t = to_x->rows[ar];
   wi_t j;
 
+  if (ff->kernels.addmul_row != NULL) {
+    const word bitmask_begin = __M4RI_RIGHT_BITMASK(m4ri_radix - (start%m4ri_radix));
+    gf2e_split_t t;
+    gf2e_split_init(&t, ff, x);
+
+    /* elements are multiplied independently, so masking the input masks the output */
+    word tmp;
+    if(to_x->width-startblock == 1) {
+      tmp = _f[startblock] & bitmask_begin & bitmask_end;
+      ff->kernels.addmul_row(_t + startblock, &tmp, &t, 1);
+    } else {
+      tmp = _f[startblock] & bitmask_begin;
+      ff->kernels.addmul_row(_t + startblock, &tmp, &t, 1);
+      ff->kernels.addmul_row(_t + startblock + 1, _f + startblock + 1, &t, to_x->width - startblock - 2);
+      tmp = _f[to_x->width-1] & bitmask_end;
+      ff->kernels.addmul_row(_t + to_x->width - 1, &tmp, &t, 1);
+    }
+    return;
+  }
+
   register word __f = _f[startblock]>>(start%m4ri_radix);
   register word __t = _t[startblock];
 
   if(A->w == 2) {
     switch( (start/2) % 32) {
-    case  0:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 0;  __f >>= 2;
-    case  1:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 2;  __f >>= 2;
-    case  2:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 4;  __f >>= 2;
-    case  3:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 6;  __f >>= 2;
-    case  4:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 8;  __f >>= 2;
-    case  5:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<10;  __f >>= 2;
-    case  6:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<12;  __f >>= 2;
-    case  7:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<14;  __f >>= 2;
-    case  8:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<16;  __f >>= 2;
-    case  9:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<18;  __f >>= 2;
-    case 10:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<20;  __f >>= 2;
-    case 11:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<22;  __f >>= 2;
-    case 12:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<24;  __f >>= 2;
-    case 13:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<26;  __f >>= 2;
-    case 14:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<28;  __f >>= 2;
-    case 15:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<30;  __f >>= 2;
-    case 16:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<32;  __f >>= 2;
-    case 17:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<34;  __f >>= 2;
-    case 18:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<36;  __f >>= 2;
-    case 19:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<38;  __f >>= 2;
-    case 20:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<40;  __f >>= 2;
-    case 21:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<42;  __f >>= 2;
-    case 22:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<44;  __f >>= 2;
-    case 23:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<46;  __f >>= 2;
-    case 24:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<48;  __f >>= 2;
-    case 25:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<50;  __f >>= 2;
-    case 26:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<52;  __f >>= 2;
-    case 27:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<54;  __f >>= 2;
-    case 28:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<56;  __f >>= 2;
-    case 29:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<58;  __f >>= 2;
-    case 30:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<60;  __f >>= 2;
-    case 31:  __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<62;  break;
+    case  0:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<< 0;  __f >>= 2;
+    case  1:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<< 2;  __f >>= 2;
+    case  2:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<< 4;  __f >>= 2;
+    case  3:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<< 6;  __f >>= 2;
+    case  4:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<< 8;  __f >>= 2;
+    case  5:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<10;  __f >>= 2;
+    case  6:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<12;  __f >>= 2;
+    case  7:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<14;  __f >>= 2;
+    case  8:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<16;  __f >>= 2;
+    case  9:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<18;  __f >>= 2;
+    case 10:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<20;  __f >>= 2;
+    case 11:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<22;  __f >>= 2;
+    case 12:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<24;  __f >>= 2;
+    case 13:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<26;  __f >>= 2;
+    case 14:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<28;  __f >>= 2;
+    case 15:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<30;  __f >>= 2;
+    case 16:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<32;  __f >>= 2;
+    case 17:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<34;  __f >>= 2;
+    case 18:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<36;  __f >>= 2;
+    case 19:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<38;  __f >>= 2;
+    case 20:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<40;  __f >>= 2;
+    case 21:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<42;  __f >>= 2;
+    case 22:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<44;  __f >>= 2;
+    case 23:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<46;  __f >>= 2;
+    case 24:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<48;  __f >>= 2;
+    case 25:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<50;  __f >>= 2;
+    case 26:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<52;  __f >>= 2;
+    case 27:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<54;  __f >>= 2;
+    case 28:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<56;  __f >>= 2;
+    case 29:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<58;  __f >>= 2;
+    case 30:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<60;  __f >>= 2;
+    case 31:  __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<62;  break;
     default: m4ri_die("impossible");
     }
 
@@ -342,94 +426,94 @@ void mzed_add_multiple_of_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br, wo
 
     for(j=startblock+1; j<to_x->width -1; j++) {
       __f = _f[j], __t = _t[j];
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 0;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 2;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 4;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 6;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<< 8;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<10;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<12;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<14;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<16;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<18;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<20;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<22;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<24;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<26;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<28;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<30;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<32;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<34;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<36;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<38;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<40;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<42;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<44;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<46;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<48;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<50;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<52;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<54;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<56;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<58;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<60;  __f >>= 2;
-      __t ^= ff->mul(ff, x, __f & 0x0000000000000003ULL)<<62;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<< 0;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<< 2;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<< 4;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<< 6;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<< 8;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<10;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<12;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<14;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<16;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<18;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<20;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<22;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<24;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<26;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<28;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<30;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<32;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<34;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<36;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<38;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<40;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<42;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<44;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<46;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<48;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<50;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<52;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<54;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<56;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<58;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<60;  __f >>= 2;
+      __t ^= gf2e_mul(ff, x, __f & 0x0000000000000003ULL)<<62;
       _t[j] = __t;
     }
 
     switch(to_x->ncols % m4ri_radix) {
-    case  0: _t[j] ^= ff->mul(ff, x, (_f[j] & 0xC000000000000000ULL)>>62)<<62;
-    case 62: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x3000000000000000ULL)>>60)<<60;
-    case 60: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0C00000000000000ULL)>>58)<<58;
-    case 58: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0300000000000000ULL)>>56)<<56;
-    case 56: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00C0000000000000ULL)>>54)<<54;
-    case 54: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0030000000000000ULL)>>52)<<52;
-    case 52: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000C000000000000ULL)>>50)<<50;
-    case 50: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0003000000000000ULL)>>48)<<48;
-    case 48: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000C00000000000ULL)>>46)<<46;
-    case 46: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000300000000000ULL)>>44)<<44;
-    case 44: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000C0000000000ULL)>>42)<<42;
-    case 42: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000030000000000ULL)>>40)<<40;
-    case 40: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000C000000000ULL)>>38)<<38;
-    case 38: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000003000000000ULL)>>36)<<36;
-    case 36: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000C00000000ULL)>>34)<<34;
-    case 34: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000300000000ULL)>>32)<<32;
-    case 32: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000C0000000ULL)>>30)<<30;
-    case 30: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000030000000ULL)>>28)<<28;
-    case 28: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000C000000ULL)>>26)<<26;
-    case 26: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000003000000ULL)>>24)<<24;
-    case 24: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000C00000ULL)>>22)<<22;
-    case 22: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000300000ULL)>>20)<<20;
-    case 20: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000000C0000ULL)>>18)<<18;
-    case 18: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000030000ULL)>>16)<<16;
-    case 16: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000000C000ULL)>>14)<<14;
-    case 14: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000003000ULL)>>12)<<12;
-    case 12: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000000C00ULL)>>10)<<10;
-    case 10: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000000300ULL)>> 8)<< 8;
-    case  8: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000000000C0ULL)>> 6)<< 6;
-    case  6: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000000030ULL)>> 4)<< 4;
-    case  4: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000000000CULL)>> 2)<< 2;
-    case  2: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000000003ULL)>> 0)<< 0;
+    case  0: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0xC000000000000000ULL)>>62)<<62;
+    case 62: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x3000000000000000ULL)>>60)<<60;
+    case 60: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0C00000000000000ULL)>>58)<<58;
+    case 58: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0300000000000000ULL)>>56)<<56;
+    case 56: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00C0000000000000ULL)>>54)<<54;
+    case 54: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0030000000000000ULL)>>52)<<52;
+    case 52: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x000C000000000000ULL)>>50)<<50;
+    case 50: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0003000000000000ULL)>>48)<<48;
+    case 48: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000C00000000000ULL)>>46)<<46;
+    case 46: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000300000000000ULL)>>44)<<44;
+    case 44: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00000C0000000000ULL)>>42)<<42;
+    case 42: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000030000000000ULL)>>40)<<40;
+    case 40: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x000000C000000000ULL)>>38)<<38;
+    case 38: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000003000000000ULL)>>36)<<36;
+    case 36: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000C00000000ULL)>>34)<<34;
+    case 34: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000300000000ULL)>>32)<<32;
+    case 32: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00000000C0000000ULL)>>30)<<30;
+    case 30: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000030000000ULL)>>28)<<28;
+    case 28: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x000000000C000000ULL)>>26)<<26;
+    case 26: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000003000000ULL)>>24)<<24;
+    case 24: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000000C00000ULL)>>22)<<22;
+    case 22: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000000300000ULL)>>20)<<20;
+    case 20: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00000000000C0000ULL)>>18)<<18;
+    case 18: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000000030000ULL)>>16)<<16;
+    case 16: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x000000000000C000ULL)>>14)<<14;
+    case 14: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000000003000ULL)>>12)<<12;
+    case 12: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000000000C00ULL)>>10)<<10;
+    case 10: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000000000300ULL)>> 8)<< 8;
+    case  8: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00000000000000C0ULL)>> 6)<< 6;
+    case  6: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000000000030ULL)>> 4)<< 4;
+    case  4: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x000000000000000CULL)>> 2)<< 2;
+    case  2: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000000000003ULL)>> 0)<< 0;
     };
 
   } else if(A->w == 4) {
     switch( (start/4) % 16 ) {
-    case  0: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<< 0;  __f >>= 4;
-    case  1: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<< 4;  __f >>= 4;
-    case  2: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<< 8;  __f >>= 4;
-    case  3: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<12;  __f >>= 4;
-    case  4: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<16;  __f >>= 4;
-    case  5: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<20;  __f >>= 4;
-    case  6: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<24;  __f >>= 4;
-    case  7: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<28;  __f >>= 4;
-    case  8: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<32;  __f >>= 4;
-    case  9: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<36;  __f >>= 4;
-    case 10: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<40;  __f >>= 4;
-    case 11: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<44;  __f >>= 4;
-    case 12: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<48;  __f >>= 4;
-    case 13: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<52;  __f >>= 4;
-    case 14: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<56;  __f >>= 4;
-    case 15: __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<60;  break;
+    case  0: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<< 0;  __f >>= 4;
+    case  1: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<< 4;  __f >>= 4;
+    case  2: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<< 8;  __f >>= 4;
+    case  3: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<12;  __f >>= 4;
+    case  4: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<16;  __f >>= 4;
+    case  5: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<20;  __f >>= 4;
+    case  6: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<24;  __f >>= 4;
+    case  7: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<28;  __f >>= 4;
+    case  8: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<32;  __f >>= 4;
+    case  9: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<36;  __f >>= 4;
+    case 10: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<40;  __f >>= 4;
+    case 11: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<44;  __f >>= 4;
+    case 12: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<48;  __f >>= 4;
+    case 13: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<52;  __f >>= 4;
+    case 14: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<56;  __f >>= 4;
+    case 15: __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<60;  break;
     default: m4ri_die("impossible");
     }
 
@@ -443,42 +527,42 @@ void mzed_add_multiple_of_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br, wo
 
     for(j=startblock+1; j<to_x->width -1; j++) {
       __f = _f[j], __t = _t[j];
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<< 0;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<< 4;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<< 8;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<12;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<16;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<20;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<24;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<28;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<32;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<36;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<40;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<44;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<48;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<52;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<56;  __f >>= 4;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000000FULL)<<60;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<< 0;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<< 4;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<< 8;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<12;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<16;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<20;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<24;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<28;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<32;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<36;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<40;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<44;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<48;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<52;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<56;  __f >>= 4;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000000FULL)<<60;
       _t[j] = __t;
     }
 
     switch(to_x->ncols % m4ri_radix) {
-    case  0: _t[j] ^= ff->mul(ff, x, (_f[j] & 0xF000000000000000ULL)>>60)<<60;
-    case 60: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0F00000000000000ULL)>>56)<<56;
-    case 56: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00F0000000000000ULL)>>52)<<52;
-    case 52: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000F000000000000ULL)>>48)<<48;
-    case 48: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000F00000000000ULL)>>44)<<44;
-    case 44: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000F0000000000ULL)>>40)<<40;
-    case 40: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000F000000000ULL)>>36)<<36;
-    case 36: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000F00000000ULL)>>32)<<32;
-    case 32: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000F0000000ULL)>>28)<<28;
-    case 28: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000F000000ULL)>>24)<<24;
-    case 24: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000F00000ULL)>>20)<<20;
-    case 20: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000000F0000ULL)>>16)<<16;
-    case 16: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000000F000ULL)>>12)<<12;
-    case 12: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000000F00ULL)>> 8)<< 8;
-    case  8: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000000000F0ULL)>> 4)<< 4;
-    case  4: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000000000FULL)>> 0)<< 0;
+    case  0: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0xF000000000000000ULL)>>60)<<60;
+    case 60: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0F00000000000000ULL)>>56)<<56;
+    case 56: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00F0000000000000ULL)>>52)<<52;
+    case 52: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x000F000000000000ULL)>>48)<<48;
+    case 48: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000F00000000000ULL)>>44)<<44;
+    case 44: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00000F0000000000ULL)>>40)<<40;
+    case 40: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x000000F000000000ULL)>>36)<<36;
+    case 36: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000F00000000ULL)>>32)<<32;
+    case 32: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00000000F0000000ULL)>>28)<<28;
+    case 28: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x000000000F000000ULL)>>24)<<24;
+    case 24: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000000F00000ULL)>>20)<<20;
+    case 20: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00000000000F0000ULL)>>16)<<16;
+    case 16: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x000000000000F000ULL)>>12)<<12;
+    case 12: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000000000F00ULL)>> 8)<< 8;
+    case  8: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00000000000000F0ULL)>> 4)<< 4;
+    case  4: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x000000000000000FULL)>> 0)<< 0;
     };
 
   } else if (A->w == 8) {
@@ -486,14 +570,14 @@ void mzed_add_multiple_of_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br, wo
 
     __f0 = _f[startblock]>>(start%m4ri_radix), __t0 = _t[startblock];
     switch( (start/8) % 8 ) {
-    case 0: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<< 0; __f0 >>= 8;
-    case 1: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<< 8; __f0 >>= 8;
-    case 2: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<16; __f0 >>= 8;
-    case 3: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<24; __f0 >>= 8;
-    case 4: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<32; __f0 >>= 8;
-    case 5: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<40; __f0 >>= 8;
-    case 6: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<48; __f0 >>= 8;
-    case 7: __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<56; break;
+    case 0: __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<< 0; __f0 >>= 8;
+    case 1: __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<< 8; __f0 >>= 8;
+    case 2: __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<16; __f0 >>= 8;
+    case 3: __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<24; __f0 >>= 8;
+    case 4: __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<32; __f0 >>= 8;
+    case 5: __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<40; __f0 >>= 8;
+    case 6: __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<48; __f0 >>= 8;
+    case 7: __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<56; break;
     default: m4ri_die("impossible");
     }
 
@@ -508,48 +592,48 @@ void mzed_add_multiple_of_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br, wo
     for(j=startblock+1; j+2 < to_x->width; j+=2) {
       __f0 = _f[j], __t0 = _t[j];
       __f1 = _f[j+1], __t1 = _t[j+1];
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<< 0; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<< 0; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<< 8; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<< 8; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<16; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<<16; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<24; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<<24; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<32; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<<32; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<40; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<<40; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<48; __f0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<<48; __f1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<56;
-      __t1 ^= ff->mul(ff, x, __f1 & 0x00000000000000FFULL)<<56;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<< 0; __f0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __f1 & 0x00000000000000FFULL)<< 0; __f1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<< 8; __f0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __f1 & 0x00000000000000FFULL)<< 8; __f1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<16; __f0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __f1 & 0x00000000000000FFULL)<<16; __f1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<24; __f0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __f1 & 0x00000000000000FFULL)<<24; __f1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<32; __f0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __f1 & 0x00000000000000FFULL)<<32; __f1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<40; __f0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __f1 & 0x00000000000000FFULL)<<40; __f1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<48; __f0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __f1 & 0x00000000000000FFULL)<<48; __f1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<56;
+      __t1 ^= gf2e_mul(ff, x, __f1 & 0x00000000000000FFULL)<<56;
       _t[j+0] = __t0;
       _t[j+1] = __t1;
     }
 
     for(; j < to_x->width-1; j++) {
       __f0 = _f[j], __t0 = _t[j];
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<< 0; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<< 8; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<16; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<24; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<32; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<40; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<48; __f0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __f0 & 0x00000000000000FFULL)<<56;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<< 0; __f0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<< 8; __f0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<16; __f0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<24; __f0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<32; __f0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<40; __f0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<48; __f0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __f0 & 0x00000000000000FFULL)<<56;
       _t[j] = __t0;
     }
 
     switch(to_x->ncols % m4ri_radix) {
-    case  0: _t[j] ^= ff->mul(ff, x, (_f[j] & 0xFF00000000000000ULL)>>56)<<56;
-    case 56: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00FF000000000000ULL)>>48)<<48;
-    case 48: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000FF0000000000ULL)>>40)<<40;
-    case 40: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000FF00000000ULL)>>32)<<32;
-    case 32: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000FF000000ULL)>>24)<<24;
-    case 24: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000000000FF0000ULL)>>16)<<16;
-    case 16: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000000FF00ULL)>> 8)<< 8;
-    case  8: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000000000FFULL)>> 0)<< 0;
+    case  0: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0xFF00000000000000ULL)>>56)<<56;
+    case 56: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00FF000000000000ULL)>>48)<<48;
+    case 48: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000FF0000000000ULL)>>40)<<40;
+    case 40: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x000000FF00000000ULL)>>32)<<32;
+    case 32: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00000000FF000000ULL)>>24)<<24;
+    case 24: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000000000FF0000ULL)>>16)<<16;
+    case 16: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x000000000000FF00ULL)>> 8)<< 8;
+    case  8: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00000000000000FFULL)>> 0)<< 0;
     };
 
   } else if (A->w == 16) {
@@ -562,10 +646,10 @@ void mzed_add_multiple_of_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br, wo
 
     __f = _f[startblock]>>(start%m4ri_radix), __t = _t[startblock];
     switch( (start/16)%4 ) {
-    case 0: __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
-    case 1: __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
-    case 2: __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
-    case 3: __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<48; break;
+    case 0: __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
+    case 1: __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
+    case 2: __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
+    case 3: __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<48; break;
     default: m4ri_die("impossible");
     }
     if(to_x->width-startblock == 1) {
@@ -578,53 +662,53 @@ void mzed_add_multiple_of_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br, wo
 
     for(j=startblock+1; j+4<to_x->width; j+=4) {
       __f = _f[j], __t = _t[j];
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
       _t[j] = __t;
 
       __f = _f[j+1], __t = _t[j+1];
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
       _t[j+1] = __t;
 
 
       __f = _f[j+2], __t = _t[j+2];
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
       _t[j+2] = __t;
 
       __f = _f[j+3], __t = _t[j+3];
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
       _t[j+3] = __t;
     }
     for( ; j<to_x->width-1; j++) {
       __f = _f[j], __t = _t[j];
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
-      __t ^= ff->mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<< 0; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<16; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<32; __f >>= 16;
+      __t ^= gf2e_mul(ff, x, __f & 0x000000000000FFFFULL)<<48;
       _t[j] = __t;
     }
 
     switch(to_x->ncols % m4ri_radix) {
-    case  0: _t[j] ^= ff->mul(ff, x, (_f[j] & 0xFFFF000000000000ULL)>>48)<<48;
-    case 48: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x0000FFFF00000000ULL)>>32)<<32;
-    case 32: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x00000000FFFF0000ULL)>>16)<<16;
-    case 16: _t[j] ^= ff->mul(ff, x, (_f[j] & 0x000000000000FFFFULL)>> 0)<< 0;
+    case  0: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0xFFFF000000000000ULL)>>48)<<48;
+    case 48: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x0000FFFF00000000ULL)>>32)<<32;
+    case 32: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x00000000FFFF0000ULL)>>16)<<16;
+    case 16: _t[j] ^= gf2e_mul(ff, x, (_f[j] & 0x000000000000FFFFULL)>> 0)<< 0;
     };
 
   }  else {
     for(rci_t j=start_col; j<B->ncols; j++) {
-      mzed_add_elem(A, ar, j, ff->mul(ff, x, mzed_read_elem(B, br, j)));
+      mzed_add_elem(A, ar, j, gf2e_mul(ff, x, mzed_read_elem(B, br, j)));
     }
   }
 }
@@ -56,7 +56,7 @@
  * \ingroup Definitions
  */
 
-typedef struct {
+typedef struct mzed_struct {
   mzd_t *x; /**< \f$m \times n\f$ matrices over \GF2E are represented as \f$m \times (en)\f$ matrices over \GF2. */
   const gf2e *finite_field; /**< A finite field \GF2E. */
   rci_t nrows; /**< Number of rows. */
@@ -352,6 +352,8 @@ mzed_t *_mzed_mul_naive(mzed_t *C, const mzed_t *A, const mzed_t *B);
 /**
  * \brief \f$ C = a \cdot B \f$.
  *
+ * Large matrices are scaled using lookup tables which are cached by the field, see gf2e_t16_get().
+ *
  * \param C Preallocated product matrix or NULL.
  * \param a finite field element.
  * \param B Input matrix B.
@@ -495,11 +497,66 @@ static inline int mzed_is_zero(const mzed_t *A) {
  * \param x Finite field element.
  * \param start_col Column index.
  *
+ * \note This uses the row kernel selected by gf2e_init() if there is one for this field.
+ *
  * \ingroup RowOperations
  */
 
 void mzed_add_multiple_of_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br, word x, rci_t start_col);
 
+/**
+ * Return the sum of A[ar,c]*B[br,c] over all columns c.
+ *
+ * \param A Matrix.
+ * \param ar Row index in A.
+ * \param B Matrix.
+ * \param br Row index in B.
+ *
+ * \ingroup RowOperations
+ */
+
+word mzed_row_dot(const mzed_t *A, rci_t ar, const mzed_t *B, rci_t br);
+
+/**
+ * Return the first column c with start_col <= c < stop_col and A[r,c] != 0 or stop_col if there
+ * is none. Whole words of the row are tested at once.
+ *
+ * \param A Matrix.
+ * \param r Row index.
+ * \param start_col Column index.
+ * \param stop_col Column index.
+ *
+ * \ingroup RowOperations
+ */
+
+rci_t mzed_first_nonzero_in_row(const mzed_t *A, rci_t r, rci_t start_col, rci_t stop_col);
+
+/**
+ * Find the pivot (r,c) of a column-major search of A[start_row:, start_col:stop_col], i.e., the
+ * first column c with a non-zero entry and the first row r with A[r,c] != 0.
+ *
+ * Rows are searched word by word with mzed_first_nonzero_in_row() and, if first is not NULL,
+ * first[i] records for every row i a column such that A[i,c] = 0 for all start_col <= c <
+ * first[i]. Callers keep it across searches: rows which were not changed since are not searched
+ * again below first[i]. This is the case for the pivot searches of eliminations, which only
+ * change rows with a non-zero entry in the pivot column and continue right of it. Row swaps must
+ * be applied to first as well. It must be initialised to zeros.
+ *
+ * \param A Matrix.
+ * \param start_row Row index.
+ * \param start_col Column index.
+ * \param stop_col Column index.
+ * \param first Array of A->nrows columns or NULL.
+ * \param r Row of the pivot (output).
+ * \param c Column of the pivot (output).
+ *
+ * \return 1 if there is a pivot and 0 otherwise.
+ *
+ * \ingroup RowOperations
+ */
+
+int mzed_find_pivot(const mzed_t *A, rci_t start_row, rci_t start_col, rci_t stop_col, rci_t *first, rci_t *r, rci_t *c);
+
 /**
  * A[ar,c] = A[ar,c] + B[br,c] for all c >= startcol.
  *
@@ -543,6 +600,8 @@ static inline void mzed_add_row(mzed_t *A, rci_t ar, const mzed_t *B, rci_t br,
  * \param start_col Column index.
  * \param x Multiplier
  *
+ * \note This uses the row kernel selected by gf2e_init() if there is one for this field.
+ *
  * \ingroup RowOperations
  */
 
@@ -555,44 +614,68 @@ static inline void mzed_rescale_row(mzed_t *A, rci_t r, rci_t start_col, const w
   word *_a = A->x->rows[r];
   const word bitmask_begin = __M4RI_RIGHT_BITMASK(m4ri_radix - (start%m4ri_radix));
   const word bitmask_end   = A->x->high_bitmask;
+  int j;
+
+  if (ff->kernels.scale_row != NULL) {
+    gf2e_split_t t;
+    gf2e_split_init(&t, ff, x);
+
+    word tmp;
+    if(A->x->width-startblock == 1) {
+      const word mask = bitmask_begin & bitmask_end;
+      tmp = _a[startblock] & mask;
+      ff->kernels.scale_row(&tmp, &t, 1);
+      _a[startblock] = (_a[startblock] & ~mask) | tmp;
+    } else {
+      tmp = _a[startblock] & bitmask_begin;
+      ff->kernels.scale_row(&tmp, &t, 1);
+      _a[startblock] = (_a[startblock] & ~bitmask_begin) | tmp;
+      ff->kernels.scale_row(_a + startblock + 1, &t, A->x->width - startblock - 2);
+      j = A->x->width - 1;
+      tmp = _a[j] & bitmask_end;
+      ff->kernels.scale_row(&tmp, &t, 1);
+      _a[j] = (_a[j] & ~bitmask_end) | tmp;
+    }
+    return;
+  }
+
   register word __a = _a[startblock]>>(start%m4ri_radix);
   register word __t = 0;
-  int j;
 
   if(A->w == 2) {
     switch( (start/2) % 32 ) {
-    case  0:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 0;  __a >>= 2;
-    case  1:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 2;  __a >>= 2;
-    case  2:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 4;  __a >>= 2;
-    case  3:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 6;  __a >>= 2;
-    case  4:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 8;  __a >>= 2;
-    case  5:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<10;  __a >>= 2;
-    case  6:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<12;  __a >>= 2;
-    case  7:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<14;  __a >>= 2;
-    case  8:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<16;  __a >>= 2;
-    case  9:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<18;  __a >>= 2;
-    case 10:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<20;  __a >>= 2;
-    case 11:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<22;  __a >>= 2;
-    case 12:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<24;  __a >>= 2;
-    case 13:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<26;  __a >>= 2;
-    case 14:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<28;  __a >>= 2;
-    case 15:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<30;  __a >>= 2;
-    case 16:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<32;  __a >>= 2;
-    case 17:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<34;  __a >>= 2;
-    case 18:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<36;  __a >>= 2;
-    case 19:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<38;  __a >>= 2;
-    case 20:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<40;  __a >>= 2;
-    case 21:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<42;  __a >>= 2;
-    case 22:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<44;  __a >>= 2;
-    case 23:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<46;  __a >>= 2;
-    case 24:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<48;  __a >>= 2;
-    case 25:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<50;  __a >>= 2;
-    case 26:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<52;  __a >>= 2;
-    case 27:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<54;  __a >>= 2;
-    case 28:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<56;  __a >>= 2;
-    case 29:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<58;  __a >>= 2;
-    case 30:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<60;  __a >>= 2;
-    case 31:  __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<62;  break;
+    case  0:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<< 0;  __a >>= 2;
+    case  1:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<< 2;  __a >>= 2;
+    case  2:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<< 4;  __a >>= 2;
+    case  3:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<< 6;  __a >>= 2;
+    case  4:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<< 8;  __a >>= 2;
+    case  5:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<10;  __a >>= 2;
+    case  6:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<12;  __a >>= 2;
+    case  7:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<14;  __a >>= 2;
+    case  8:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<16;  __a >>= 2;
+    case  9:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<18;  __a >>= 2;
+    case 10:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<20;  __a >>= 2;
+    case 11:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<22;  __a >>= 2;
+    case 12:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<24;  __a >>= 2;
+    case 13:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<26;  __a >>= 2;
+    case 14:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<28;  __a >>= 2;
+    case 15:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<30;  __a >>= 2;
+    case 16:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<32;  __a >>= 2;
+    case 17:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<34;  __a >>= 2;
+    case 18:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<36;  __a >>= 2;
+    case 19:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<38;  __a >>= 2;
+    case 20:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<40;  __a >>= 2;
+    case 21:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<42;  __a >>= 2;
+    case 22:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<44;  __a >>= 2;
+    case 23:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<46;  __a >>= 2;
+    case 24:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<48;  __a >>= 2;
+    case 25:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<50;  __a >>= 2;
+    case 26:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<52;  __a >>= 2;
+    case 27:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<54;  __a >>= 2;
+    case 28:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<56;  __a >>= 2;
+    case 29:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<58;  __a >>= 2;
+    case 30:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<60;  __a >>= 2;
+    case 31:  __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<62;  break;
     default: m4ri_die("impossible");
     }
     if(A->x->width-startblock == 1) {
@@ -606,96 +689,96 @@ static inline void mzed_rescale_row(mzed_t *A, rci_t r, rci_t start_col, const w
 
     for(j=startblock+1; j<A->x->width -1; j++) {
       __a = _a[j], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 0;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 2;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 4;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 6;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<< 8;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<10;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<12;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<14;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<16;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<18;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<20;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<22;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<24;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<26;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<28;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<30;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<32;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<34;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<36;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<38;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<40;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<42;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<44;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<46;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<48;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<50;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<52;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<54;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<56;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<58;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<60;  __a >>= 2;
-      __t ^= ff->mul(ff, x, __a & 0x0000000000000003ULL)<<62;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<< 0;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<< 2;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<< 4;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<< 6;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<< 8;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<10;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<12;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<14;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<16;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<18;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<20;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<22;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<24;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<26;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<28;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<30;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<32;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<34;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<36;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<38;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<40;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<42;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<44;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<46;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<48;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<50;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<52;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<54;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<56;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<58;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<60;  __a >>= 2;
+      __t ^= gf2e_mul(ff, x, __a & 0x0000000000000003ULL)<<62;
       _a[j] = __t;
     }
 
     __t = _a[j] & ~bitmask_end;
     switch(A->x->ncols % m4ri_radix) {
-    case  0: __t ^= ff->mul(ff, x, (_a[j] & 0xC000000000000000ULL)>>62)<<62;
-    case 62: __t ^= ff->mul(ff, x, (_a[j] & 0x3000000000000000ULL)>>60)<<60;
-    case 60: __t ^= ff->mul(ff, x, (_a[j] & 0x0C00000000000000ULL)>>58)<<58;
-    case 58: __t ^= ff->mul(ff, x, (_a[j] & 0x0300000000000000ULL)>>56)<<56;
-    case 56: __t ^= ff->mul(ff, x, (_a[j] & 0x00C0000000000000ULL)>>54)<<54;
-    case 54: __t ^= ff->mul(ff, x, (_a[j] & 0x0030000000000000ULL)>>52)<<52;
-    case 52: __t ^= ff->mul(ff, x, (_a[j] & 0x000C000000000000ULL)>>50)<<50;
-    case 50: __t ^= ff->mul(ff, x, (_a[j] & 0x0003000000000000ULL)>>48)<<48;
-    case 48: __t ^= ff->mul(ff, x, (_a[j] & 0x0000C00000000000ULL)>>46)<<46;
-    case 46: __t ^= ff->mul(ff, x, (_a[j] & 0x0000300000000000ULL)>>44)<<44;
-    case 44: __t ^= ff->mul(ff, x, (_a[j] & 0x00000C0000000000ULL)>>42)<<42;
-    case 42: __t ^= ff->mul(ff, x, (_a[j] & 0x0000030000000000ULL)>>40)<<40;
-    case 40: __t ^= ff->mul(ff, x, (_a[j] & 0x000000C000000000ULL)>>38)<<38;
-    case 38: __t ^= ff->mul(ff, x, (_a[j] & 0x0000003000000000ULL)>>36)<<36;
-    case 36: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000C00000000ULL)>>34)<<34;
-    case 34: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000300000000ULL)>>32)<<32;
-    case 32: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000C0000000ULL)>>30)<<30;
-    case 30: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000030000000ULL)>>28)<<28;
-    case 28: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000C000000ULL)>>26)<<26;
-    case 26: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000003000000ULL)>>24)<<24;
-    case 24: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000C00000ULL)>>22)<<22;
-    case 22: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000300000ULL)>>20)<<20;
-    case 20: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000000C0000ULL)>>18)<<18;
-    case 18: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000030000ULL)>>16)<<16;
-    case 16: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000000C000ULL)>>14)<<14;
-    case 14: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000003000ULL)>>12)<<12;
-    case 12: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000000C00ULL)>>10)<<10;
-    case 10: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000000300ULL)>> 8)<< 8;
-    case  8: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000000000C0ULL)>> 6)<< 6;
-    case  6: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000000030ULL)>> 4)<< 4;
-    case  4: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000000000CULL)>> 2)<< 2;
-    case  2: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000000003ULL)>> 0)<< 0;
+    case  0: __t ^= gf2e_mul(ff, x, (_a[j] & 0xC000000000000000ULL)>>62)<<62;
+    case 62: __t ^= gf2e_mul(ff, x, (_a[j] & 0x3000000000000000ULL)>>60)<<60;
+    case 60: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0C00000000000000ULL)>>58)<<58;
+    case 58: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0300000000000000ULL)>>56)<<56;
+    case 56: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00C0000000000000ULL)>>54)<<54;
+    case 54: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0030000000000000ULL)>>52)<<52;
+    case 52: __t ^= gf2e_mul(ff, x, (_a[j] & 0x000C000000000000ULL)>>50)<<50;
+    case 50: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0003000000000000ULL)>>48)<<48;
+    case 48: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000C00000000000ULL)>>46)<<46;
+    case 46: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000300000000000ULL)>>44)<<44;
+    case 44: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00000C0000000000ULL)>>42)<<42;
+    case 42: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000030000000000ULL)>>40)<<40;
+    case 40: __t ^= gf2e_mul(ff, x, (_a[j] & 0x000000C000000000ULL)>>38)<<38;
+    case 38: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000003000000000ULL)>>36)<<36;
+    case 36: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000C00000000ULL)>>34)<<34;
+    case 34: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000300000000ULL)>>32)<<32;
+    case 32: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00000000C0000000ULL)>>30)<<30;
+    case 30: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000030000000ULL)>>28)<<28;
+    case 28: __t ^= gf2e_mul(ff, x, (_a[j] & 0x000000000C000000ULL)>>26)<<26;
+    case 26: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000003000000ULL)>>24)<<24;
+    case 24: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000000C00000ULL)>>22)<<22;
+    case 22: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000000300000ULL)>>20)<<20;
+    case 20: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00000000000C0000ULL)>>18)<<18;
+    case 18: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000000030000ULL)>>16)<<16;
+    case 16: __t ^= gf2e_mul(ff, x, (_a[j] & 0x000000000000C000ULL)>>14)<<14;
+    case 14: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000000003000ULL)>>12)<<12;
+    case 12: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000000000C00ULL)>>10)<<10;
+    case 10: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000000000300ULL)>> 8)<< 8;
+    case  8: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00000000000000C0ULL)>> 6)<< 6;
+    case  6: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000000000030ULL)>> 4)<< 4;
+    case  4: __t ^= gf2e_mul(ff, x, (_a[j] & 0x000000000000000CULL)>> 2)<< 2;
+    case  2: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000000000003ULL)>> 0)<< 0;
     };
     _a[j] = __t;
 
   } else if(A->w == 4) {
     switch( (start/4)%16 ) {
-    case  0: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<< 0;  __a >>= 4;
-    case  1: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<< 4;  __a >>= 4;
-    case  2: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<< 8;  __a >>= 4;
-    case  3: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<12;  __a >>= 4;
-    case  4: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<16;  __a >>= 4;
-    case  5: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<20;  __a >>= 4;
-    case  6: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<24;  __a >>= 4;
-    case  7: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<28;  __a >>= 4;
-    case  8: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<32;  __a >>= 4;
-    case  9: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<36;  __a >>= 4;
-    case 10: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<40;  __a >>= 4;
-    case 11: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<44;  __a >>= 4;
-    case 12: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<48;  __a >>= 4;
-    case 13: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<52;  __a >>= 4;
-    case 14: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<56;  __a >>= 4;
-    case 15: __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<60;  break;
+    case  0: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<< 0;  __a >>= 4;
+    case  1: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<< 4;  __a >>= 4;
+    case  2: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<< 8;  __a >>= 4;
+    case  3: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<12;  __a >>= 4;
+    case  4: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<16;  __a >>= 4;
+    case  5: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<20;  __a >>= 4;
+    case  6: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<24;  __a >>= 4;
+    case  7: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<28;  __a >>= 4;
+    case  8: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<32;  __a >>= 4;
+    case  9: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<36;  __a >>= 4;
+    case 10: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<40;  __a >>= 4;
+    case 11: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<44;  __a >>= 4;
+    case 12: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<48;  __a >>= 4;
+    case 13: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<52;  __a >>= 4;
+    case 14: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<56;  __a >>= 4;
+    case 15: __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<60;  break;
     default: m4ri_die("impossible");
     }
     if(A->x->width-startblock == 1) {
@@ -709,43 +792,43 @@ static inline void mzed_rescale_row(mzed_t *A, rci_t r, rci_t start_col, const w
 
     for(j=startblock+1; j<A->x->width -1; j++) {
       __a = _a[j], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<< 0;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<< 4;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<< 8;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<12;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<16;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<20;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<24;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<28;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<32;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<36;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<40;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<44;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<48;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<52;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<56;  __a >>= 4;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000000FULL)<<60;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<< 0;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<< 4;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<< 8;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<12;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<16;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<20;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<24;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<28;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<32;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<36;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<40;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<44;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<48;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<52;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<56;  __a >>= 4;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000000FULL)<<60;
       _a[j] = __t;
     }
 
     __t = _a[j] & ~bitmask_end;
     switch(A->x->ncols % m4ri_radix) {
-    case  0: __t ^= ff->mul(ff, x, (_a[j] & 0xF000000000000000ULL)>>60)<<60;
-    case 60: __t ^= ff->mul(ff, x, (_a[j] & 0x0F00000000000000ULL)>>56)<<56;
-    case 56: __t ^= ff->mul(ff, x, (_a[j] & 0x00F0000000000000ULL)>>52)<<52;
-    case 52: __t ^= ff->mul(ff, x, (_a[j] & 0x000F000000000000ULL)>>48)<<48;
-    case 48: __t ^= ff->mul(ff, x, (_a[j] & 0x0000F00000000000ULL)>>44)<<44;
-    case 44: __t ^= ff->mul(ff, x, (_a[j] & 0x00000F0000000000ULL)>>40)<<40;
-    case 40: __t ^= ff->mul(ff, x, (_a[j] & 0x000000F000000000ULL)>>36)<<36;
-    case 36: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000F00000000ULL)>>32)<<32;
-    case 32: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000F0000000ULL)>>28)<<28;
-    case 28: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000F000000ULL)>>24)<<24;
-    case 24: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000F00000ULL)>>20)<<20;
-    case 20: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000000F0000ULL)>>16)<<16;
-    case 16: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000000F000ULL)>>12)<<12;
-    case 12: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000000F00ULL)>> 8)<< 8;
-    case  8: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000000000F0ULL)>> 4)<< 4;
-    case  4: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000000000FULL)>> 0)<< 0;
+    case  0: __t ^= gf2e_mul(ff, x, (_a[j] & 0xF000000000000000ULL)>>60)<<60;
+    case 60: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0F00000000000000ULL)>>56)<<56;
+    case 56: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00F0000000000000ULL)>>52)<<52;
+    case 52: __t ^= gf2e_mul(ff, x, (_a[j] & 0x000F000000000000ULL)>>48)<<48;
+    case 48: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000F00000000000ULL)>>44)<<44;
+    case 44: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00000F0000000000ULL)>>40)<<40;
+    case 40: __t ^= gf2e_mul(ff, x, (_a[j] & 0x000000F000000000ULL)>>36)<<36;
+    case 36: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000F00000000ULL)>>32)<<32;
+    case 32: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00000000F0000000ULL)>>28)<<28;
+    case 28: __t ^= gf2e_mul(ff, x, (_a[j] & 0x000000000F000000ULL)>>24)<<24;
+    case 24: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000000F00000ULL)>>20)<<20;
+    case 20: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00000000000F0000ULL)>>16)<<16;
+    case 16: __t ^= gf2e_mul(ff, x, (_a[j] & 0x000000000000F000ULL)>>12)<<12;
+    case 12: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000000000F00ULL)>> 8)<< 8;
+    case  8: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00000000000000F0ULL)>> 4)<< 4;
+    case  4: __t ^= gf2e_mul(ff, x, (_a[j] & 0x000000000000000FULL)>> 0)<< 0;
     };
     _a[j] = __t;
 
@@ -757,14 +840,14 @@ static inline void mzed_rescale_row(mzed_t *A, rci_t r, rci_t start_col, const w
     register word __t1;
 
     switch( (start/8) %8 ) {
-    case 0: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<< 0; __a0 >>= 8;
-    case 1: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<< 8; __a0 >>= 8;
-    case 2: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<<16; __a0 >>= 8;
-    case 3: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<<24; __a0 >>= 8;
-    case 4: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<<32; __a0 >>= 8;
-    case 5: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<<40; __a0 >>= 8;
-    case 6: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<<48; __a0 >>= 8;
-    case 7: __t0 ^= ff->mul(ff, x, (__a0 & 0x00000000000000FFULL))<<56; break;
+    case 0: __t0 ^= gf2e_mul(ff, x, (__a0 & 0x00000000000000FFULL))<< 0; __a0 >>= 8;
+    case 1: __t0 ^= gf2e_mul(ff, x, (__a0 & 0x00000000000000FFULL))<< 8; __a0 >>= 8;
+    case 2: __t0 ^= gf2e_mul(ff, x, (__a0 & 0x00000000000000FFULL))<<16; __a0 >>= 8;
+    case 3: __t0 ^= gf2e_mul(ff, x, (__a0 & 0x00000000000000FFULL))<<24; __a0 >>= 8;
+    case 4: __t0 ^= gf2e_mul(ff, x, (__a0 & 0x00000000000000FFULL))<<32; __a0 >>= 8;
+    case 5: __t0 ^= gf2e_mul(ff, x, (__a0 & 0x00000000000000FFULL))<<40; __a0 >>= 8;
+    case 6: __t0 ^= gf2e_mul(ff, x, (__a0 & 0x00000000000000FFULL))<<48; __a0 >>= 8;
+    case 7: __t0 ^= gf2e_mul(ff, x, (__a0 & 0x00000000000000FFULL))<<56; break;
     default: m4ri_die("impossible");
     }
     if(A->x->width-startblock == 1) {
@@ -779,58 +862,58 @@ static inline void mzed_rescale_row(mzed_t *A, rci_t r, rci_t start_col, const w
     for(j=startblock+1; j+2 < A->x->width; j+=2) {
       __a0 = _a[j], __t0 = 0;
       __a1 = _a[j+1], __t1 = 0;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<< 0; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<< 0; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<< 8; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<< 8; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<16; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<<16; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<24; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<<24; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<32; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<<32; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<40; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<<40; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<48; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<<48; __a1 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<56; __a0 >>= 8;
-      __t1 ^= ff->mul(ff, x, __a1 & 0x00000000000000FFULL)<<56;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<< 0; __a0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __a1 & 0x00000000000000FFULL)<< 0; __a1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<< 8; __a0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __a1 & 0x00000000000000FFULL)<< 8; __a1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<<16; __a0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __a1 & 0x00000000000000FFULL)<<16; __a1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<<24; __a0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __a1 & 0x00000000000000FFULL)<<24; __a1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<<32; __a0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __a1 & 0x00000000000000FFULL)<<32; __a1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<<40; __a0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __a1 & 0x00000000000000FFULL)<<40; __a1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<<48; __a0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __a1 & 0x00000000000000FFULL)<<48; __a1 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<<56; __a0 >>= 8;
+      __t1 ^= gf2e_mul(ff, x, __a1 & 0x00000000000000FFULL)<<56;
       _a[j+0] = __t0;
       _a[j+1] = __t1;
     }
 
     for(; j < A->x->width-1; j++) {
       __a0 = _a[j], __t0 = 0;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<< 0; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<< 8; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<16; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<24; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<32; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<40; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<48; __a0 >>= 8;
-      __t0 ^= ff->mul(ff, x, __a0 & 0x00000000000000FFULL)<<56;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<< 0; __a0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<< 8; __a0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<<16; __a0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<<24; __a0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<<32; __a0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<<40; __a0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<<48; __a0 >>= 8;
+      __t0 ^= gf2e_mul(ff, x, __a0 & 0x00000000000000FFULL)<<56;
       _a[j] = __t0;
     }
 
     __t = _a[j] & ~bitmask_end;
     switch(A->x->ncols % m4ri_radix ) {
-    case  0: __t ^= ff->mul(ff, x, (_a[j] & 0xFF00000000000000ULL)>>56)<<56;
-    case 56: __t ^= ff->mul(ff, x, (_a[j] & 0x00FF000000000000ULL)>>48)<<48;
-    case 48: __t ^= ff->mul(ff, x, (_a[j] & 0x0000FF0000000000ULL)>>40)<<40;
-    case 40: __t ^= ff->mul(ff, x, (_a[j] & 0x000000FF00000000ULL)>>32)<<32;
-    case 32: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000FF000000ULL)>>24)<<24;
-    case 24: __t ^= ff->mul(ff, x, (_a[j] & 0x0000000000FF0000ULL)>>16)<<16;
-    case 16: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000000FF00ULL)>> 8)<< 8;
-    case  8: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000000000FFULL)>> 0)<< 0;
+    case  0: __t ^= gf2e_mul(ff, x, (_a[j] & 0xFF00000000000000ULL)>>56)<<56;
+    case 56: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00FF000000000000ULL)>>48)<<48;
+    case 48: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000FF0000000000ULL)>>40)<<40;
+    case 40: __t ^= gf2e_mul(ff, x, (_a[j] & 0x000000FF00000000ULL)>>32)<<32;
+    case 32: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00000000FF000000ULL)>>24)<<24;
+    case 24: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000000000FF0000ULL)>>16)<<16;
+    case 16: __t ^= gf2e_mul(ff, x, (_a[j] & 0x000000000000FF00ULL)>> 8)<< 8;
+    case  8: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00000000000000FFULL)>> 0)<< 0;
     };
     _a[j] = __t;
 
   } else if (A->w == 16) {
     switch( (start/16) %4 ) {
-    case 0: __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
-    case 1: __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
-    case 2: __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
-    case 3: __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<48; break;
+    case 0: __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
+    case 1: __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
+    case 2: __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
+    case 3: __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<48; break;
     default: m4ri_die("impossible");
     }
     if(A->x->width-startblock == 1) {
@@ -844,54 +927,54 @@ static inline void mzed_rescale_row(mzed_t *A, rci_t r, rci_t start_col, const w
 
     for(j=startblock+1; j+4<A->x->width; j+=4) {
       __a = _a[j], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
       _a[j] = __t;
 
       __a = _a[j+1], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
       _a[j+1] = __t;
 
       __a = _a[j+2], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
       _a[j+2] = __t;
 
       __a = _a[j+3], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
       _a[j+3] = __t;
     }
     for( ; j<A->x->width-1; j++) {
       __a = _a[j], __t = 0;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
-      __t ^= ff->mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<< 0; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<16; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<32; __a >>= 16;
+      __t ^= gf2e_mul(ff, x, __a & 0x000000000000FFFFULL)<<48;
       _a[j] = __t;
     }
 
     __t = _a[j] & ~bitmask_end;
     switch(A->x->ncols % m4ri_radix) {
-    case  0: __t ^= ff->mul(ff, x, (_a[j] & 0xFFFF000000000000ULL)>>48)<<48;
-    case 48: __t ^= ff->mul(ff, x, (_a[j] & 0x0000FFFF00000000ULL)>>32)<<32;
-    case 32: __t ^= ff->mul(ff, x, (_a[j] & 0x00000000FFFF0000ULL)>>16)<<16;
-    case 16: __t ^= ff->mul(ff, x, (_a[j] & 0x000000000000FFFFULL)>> 0)<< 0;
+    case  0: __t ^= gf2e_mul(ff, x, (_a[j] & 0xFFFF000000000000ULL)>>48)<<48;
+    case 48: __t ^= gf2e_mul(ff, x, (_a[j] & 0x0000FFFF00000000ULL)>>32)<<32;
+    case 32: __t ^= gf2e_mul(ff, x, (_a[j] & 0x00000000FFFF0000ULL)>>16)<<16;
+    case 16: __t ^= gf2e_mul(ff, x, (_a[j] & 0x000000000000FFFFULL)>> 0)<< 0;
     };
     _a[j] = __t;
 
   } else {
     for(rci_t j=start_col; j<A->ncols; j++) {
-      mzed_write_elem(A, r, j, ff->mul(ff, x, mzed_read_elem(A, r, j)));
+      mzed_write_elem(A, r, j, gf2e_mul(ff, x, mzed_read_elem(A, r, j)));
     }
   }
 }
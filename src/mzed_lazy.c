@@ -0,0 +1,183 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include "mzed_lazy.h"
+#include "conversion.h"
+#include "strassen.h"
+#include "trsm.h"
+#include "ple.h"
+#include "newton_john.h"
+#include "profile.h"
+
+/**
+ * Same crossover as _mzed_mul(): Karatsuba on bitsliced matrices for large products.
+ */
+
+static inline int _mzed_lazy_use_slice(const gf2e *ff, rci_t m, rci_t l, rci_t n) {
+  return m4rie_profile_use_karatsuba(ff, m, l, n);
+}
+
+mzed_lazy_t *mzed_lazy_init(const gf2e *ff, rci_t m, rci_t n) {
+  mzed_lazy_t *A = (mzed_lazy_t*)m4ri_mm_calloc(1, sizeof(mzed_lazy_t));
+  A->finite_field = ff;
+  A->nrows = m;
+  A->ncols = n;
+  A->zero = 1;
+  return A;
+}
+
+mzed_lazy_t *mzed_lazy_from_mzed(mzed_t *A) {
+  mzed_lazy_t *L = mzed_lazy_init(A->finite_field, A->nrows, A->ncols);
+  L->e = A;
+  L->valid = __M4RIE_LAZY_MZED;
+  L->zero = 0;
+  return L;
+}
+
+mzed_lazy_t *mzed_lazy_from_slice(mzd_slice_t *A) {
+  mzed_lazy_t *L = mzed_lazy_init(A->finite_field, A->nrows, A->ncols);
+  L->s = A;
+  L->valid = __M4RIE_LAZY_SLICE;
+  L->zero = 0;
+  return L;
+}
+
+void mzed_lazy_free(mzed_lazy_t *A) {
+  if (A->e)
+    mzed_free(A->e);
+  if (A->s)
+    mzd_slice_free(A->s);
+  m4ri_mm_free(A);
+}
+
+void mzed_lazy_set_ui(mzed_lazy_t *A, word value) {
+  if (value == 0) {
+    A->valid = 0;
+    A->zero = 1;
+    return;
+  }
+  mzed_set_ui(mzed_lazy_write_mzed(A), value);
+}
+
+const mzed_t *mzed_lazy_read_mzed(mzed_lazy_t *A) {
+  if (A->valid & __M4RIE_LAZY_MZED)
+    return A->e;
+
+  if (A->zero) {
+    if (A->e == NULL)
+      A->e = mzed_init(A->finite_field, A->nrows, A->ncols);
+    else
+      mzed_set_ui(A->e, 0);
+  } else {
+    A->e = mzed_cling(A->e, A->s);
+    A->conversions++;
+  }
+  A->valid |= __M4RIE_LAZY_MZED;
+  return A->e;
+}
+
+mzed_t *mzed_lazy_write_mzed(mzed_lazy_t *A) {
+  mzed_lazy_read_mzed(A);
+  A->valid = __M4RIE_LAZY_MZED;
+  A->zero = 0;
+  return A->e;
+}
+
+const mzd_slice_t *mzed_lazy_read_slice(mzed_lazy_t *A) {
+  if (A->valid & __M4RIE_LAZY_SLICE)
+    return A->s;
+
+  if (A->zero) {
+    if (A->s == NULL)
+      A->s = mzd_slice_init(A->finite_field, A->nrows, A->ncols);
+    else
+      mzd_slice_set_ui(A->s, 0);
+  } else {
+    A->s = mzed_slice(A->s, A->e);
+    A->conversions++;
+  }
+  A->valid |= __M4RIE_LAZY_SLICE;
+  return A->s;
+}
+
+mzd_slice_t *mzed_lazy_write_slice(mzed_lazy_t *A) {
+  mzed_lazy_read_slice(A);
+  A->valid = __M4RIE_LAZY_SLICE;
+  A->zero = 0;
+  return A->s;
+}
+
+mzed_lazy_t *mzed_lazy_addmul(mzed_lazy_t *C, mzed_lazy_t *A, mzed_lazy_t *B) {
+  if (A->ncols != B->nrows || A->finite_field != B->finite_field)
+    m4ri_die("mzed_lazy_addmul: rows, columns and fields must match.\n");
+  if (C->finite_field != A->finite_field || C->nrows != A->nrows || C->ncols != B->ncols)
+    m4ri_die("mzed_lazy_addmul: rows and columns of returned matrix must match.\n");
+
+  if (A->zero || B->zero)
+    return C;
+
+  if (_mzed_lazy_use_slice(A->finite_field, A->nrows, A->ncols, B->ncols)) {
+    const mzd_slice_t *As = mzed_lazy_read_slice(A);
+    const mzd_slice_t *Bs = mzed_lazy_read_slice(B);
+    _mzd_slice_addmul(mzed_lazy_write_slice(C), As, Bs);
+  } else {
+    const mzed_t *Ae = mzed_lazy_read_mzed(A);
+    const mzed_t *Be = mzed_lazy_read_mzed(B);
+    mzed_t *Ce = mzed_lazy_write_mzed(C);
+    _mzed_addmul_strassen(Ce, Ae, Be, _mzed_strassen_cutoff(Ce, Ae, Be));
+  }
+  return C;
+}
+
+mzed_lazy_t *mzed_lazy_mul(mzed_lazy_t *C, mzed_lazy_t *A, mzed_lazy_t *B) {
+  if (C == NULL)
+    C = mzed_lazy_init(A->finite_field, A->nrows, B->ncols);
+  else
+    mzed_lazy_set_ui(C, 0);
+  return mzed_lazy_addmul(C, A, B);
+}
+
+rci_t mzed_lazy_ple(mzed_lazy_t *A, mzp_t *P, mzp_t *Q) {
+  /* same crossover as _mzed_ple() */
+  const rci_t cutoff = m4rie_profile_get()->ple;
+  if (A->ncols > m4ri_radix && (gf2e_degree_to_w(A->finite_field) * A->ncols * A->nrows) > cutoff)
+    return _mzd_slice_ple(mzed_lazy_write_slice(A), P, Q, cutoff);
+  else
+    return mzed_ple_newton_john(mzed_lazy_write_mzed(A), P, Q);
+}
+
+void mzed_lazy_trsm_upper_left(mzed_lazy_t *U, mzed_lazy_t *B) {
+  if (_mzed_lazy_use_slice(U->finite_field, U->nrows, U->ncols, B->ncols)) {
+    const mzd_slice_t *Us = mzed_lazy_read_slice(U);
+    mzd_slice_trsm_upper_left(Us, mzed_lazy_write_slice(B));
+  } else {
+    const mzed_t *Ue = mzed_lazy_read_mzed(U);
+    mzed_trsm_upper_left(Ue, mzed_lazy_write_mzed(B));
+  }
+}
+
+void mzed_lazy_trsm_lower_left(mzed_lazy_t *L, mzed_lazy_t *B) {
+  if (_mzed_lazy_use_slice(L->finite_field, L->nrows, L->ncols, B->ncols)) {
+    const mzd_slice_t *Ls = mzed_lazy_read_slice(L);
+    mzd_slice_trsm_lower_left(Ls, mzed_lazy_write_slice(B));
+  } else {
+    const mzed_t *Le = mzed_lazy_read_mzed(L);
+    mzed_trsm_lower_left(Le, mzed_lazy_write_mzed(B));
+  }
+}
@@ -0,0 +1,235 @@
+/**
+ * \file mzed_lazy.h
+ *
+ * \brief Matrices over \GF2E which keep both the packed and the bitsliced representation
+ *
+ * Multiplication via Karatsuba and asymptotically fast PLE decomposition work on mzd_slice_t,
+ * Newton-John tables and Strassen-Winograd on mzed_t. Calling these functions on mzed_t
+ * directly converts the whole matrix back and forth on every call. A mzed_lazy_t caches both
+ * forms together with the information which of them is up to date, so that a chain such as PLE
+ * followed by TRSM followed by a multiplication converts each operand at most once.
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_MZED_LAZY_H
+#define M4RIE_MZED_LAZY_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <m4ri/m4ri.h>
+#include <m4rie/mzed.h>
+#include <m4rie/mzd_slice.h>
+
+/**
+ * The packed representation is up to date.
+ */
+
+#define __M4RIE_LAZY_MZED  0x1
+
+/**
+ * The bitsliced representation is up to date.
+ */
+
+#define __M4RIE_LAZY_SLICE 0x2
+
+/**
+ * \brief Dense matrices over \GF2E in packed and bitsliced representation.
+ *
+ * Either representation may be NULL until it is first requested. Once allocated it is kept until
+ * the matrix is freed.
+ *
+ * \ingroup Definitions
+ */
+
+typedef struct {
+  const gf2e *finite_field; /**< Finite field. */
+  rci_t nrows;              /**< Number of rows. */
+  rci_t ncols;              /**< Number of columns. */
+  mzed_t *e;                /**< Packed representation or NULL. */
+  mzd_slice_t *s;           /**< Bitsliced representation or NULL. */
+  int valid;                /**< Up to date representations, see __M4RIE_LAZY_MZED and __M4RIE_LAZY_SLICE. */
+  int zero;                 /**< The matrix is known to be zero, no representation needs to be read. */
+  size_t conversions;       /**< Number of calls to mzed_slice() or mzed_cling() made for this matrix. */
+} mzed_lazy_t;
+
+/**
+ * \brief Create a new zero matrix of dimension m x n.
+ *
+ * No memory for either representation is allocated before it is requested.
+ *
+ * \param ff Finite field.
+ * \param m Number of rows.
+ * \param n Number of columns.
+ *
+ * \ingroup Constructions
+ */
+
+mzed_lazy_t *mzed_lazy_init(const gf2e *ff, rci_t m, rci_t n);
+
+/**
+ * \brief Create a new matrix from A, taking ownership of A.
+ *
+ * \param A Matrix, is freed by mzed_lazy_free().
+ *
+ * \ingroup Constructions
+ */
+
+mzed_lazy_t *mzed_lazy_from_mzed(mzed_t *A);
+
+/**
+ * \brief Create a new matrix from A, taking ownership of A.
+ *
+ * \param A Matrix, is freed by mzed_lazy_free().
+ *
+ * \ingroup Constructions
+ */
+
+mzed_lazy_t *mzed_lazy_from_slice(mzd_slice_t *A);
+
+/**
+ * \brief Free a matrix created with mzed_lazy_init(), mzed_lazy_from_mzed() or
+ * mzed_lazy_from_slice().
+ *
+ * \param A Matrix.
+ *
+ * \ingroup Constructions
+ */
+
+void mzed_lazy_free(mzed_lazy_t *A);
+
+/**
+ * \brief Set the diagonal of A to value and everything else to zero.
+ *
+ * Setting A to zero only records this fact, no representation is touched.
+ *
+ * \param A Matrix.
+ * \param value Finite field element.
+ *
+ * \ingroup Assignment
+ */
+
+void mzed_lazy_set_ui(mzed_lazy_t *A, word value);
+
+/**
+ * \brief Return the packed representation of A for reading.
+ *
+ * The returned matrix must not be modified and is valid until the next call which modifies A.
+ *
+ * \param A Matrix.
+ */
+
+const mzed_t *mzed_lazy_read_mzed(mzed_lazy_t *A);
+
+/**
+ * \brief Return the packed representation of A for modification.
+ *
+ * This marks the bitsliced representation as out of date.
+ *
+ * \param A Matrix.
+ */
+
+mzed_t *mzed_lazy_write_mzed(mzed_lazy_t *A);
+
+/**
+ * \brief Return the bitsliced representation of A for reading.
+ *
+ * The returned matrix must not be modified and is valid until the next call which modifies A.
+ *
+ * \param A Matrix.
+ */
+
+const mzd_slice_t *mzed_lazy_read_slice(mzed_lazy_t *A);
+
+/**
+ * \brief Return the bitsliced representation of A for modification.
+ *
+ * This marks the packed representation as out of date.
+ *
+ * \param A Matrix.
+ */
+
+mzd_slice_t *mzed_lazy_write_slice(mzed_lazy_t *A);
+
+/**
+ * \brief \f$ C = A \cdot B \f$.
+ *
+ * Uses the bitsliced representation where mzed_mul() would use Karatsuba and the packed
+ * representation otherwise.
+ *
+ * \param C Preallocated return matrix, may be NULL for automatic creation.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ *
+ * \ingroup Multiplication
+ */
+
+mzed_lazy_t *mzed_lazy_mul(mzed_lazy_t *C, mzed_lazy_t *A, mzed_lazy_t *B);
+
+/**
+ * \brief \f$ C = C + A \cdot B \f$.
+ *
+ * \param C Preallocated return matrix.
+ * \param A Input matrix A.
+ * \param B Input matrix B.
+ *
+ * \ingroup Multiplication
+ */
+
+mzed_lazy_t *mzed_lazy_addmul(mzed_lazy_t *C, mzed_lazy_t *A, mzed_lazy_t *B);
+
+/**
+ * \brief PLE decomposition: \f$ L \cdot E = P \cdot A \f$, see mzed_ple().
+ *
+ * Uses the bitsliced representation where mzed_ple() would use it and the packed representation
+ * otherwise.
+ *
+ * \param A Matrix.
+ * \param P Permutation vector of length A->nrows.
+ * \param Q Permutation vector of length A->ncols.
+ *
+ * \ingroup PLE
+ */
+
+rci_t mzed_lazy_ple(mzed_lazy_t *A, mzp_t *P, mzp_t *Q);
+
+/**
+ * \brief \f$B = U^{-1} \cdot B\f$
+ *
+ * \param U Upper-triangular matrix (other entries are ignored).
+ * \param B Matrix.
+ *
+ * \ingroup Triangular
+ */
+
+void mzed_lazy_trsm_upper_left(mzed_lazy_t *U, mzed_lazy_t *B);
+
+/**
+ * \brief \f$B = L^{-1} \cdot B\f$
+ *
+ * \param L Lower-triangular matrix (other entries are ignored).
+ * \param B Matrix.
+ *
+ * \ingroup Triangular
+ */
+
+void mzed_lazy_trsm_lower_left(mzed_lazy_t *L, mzed_lazy_t *B);
+
+#endif //M4RIE_MZED_LAZY_H
@@ -0,0 +1,152 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <stdlib.h>
+
+#include "mzed_prepared.h"
+#include "conversion.h"
+#include "strassen.h"
+#include "profile.h"
+#include "workspace.h"
+
+/**
+ * Same test as in _mzed_mul_strassen(): products with B go straight to Newton-John tables if one
+ * of the dimensions of B is closer to the cutoff than half of it.
+ */
+
+static inline int _mzed_prepared_base_case(const mzed_t *B) {
+  const rci_t cutoff = _mzed_strassen_cutoff(B, B, B);
+  return (abs((long)B->nrows - (long)cutoff) < abs((long)(B->nrows/2) - (long)cutoff) ||
+          abs((long)B->ncols - (long)cutoff) < abs((long)(B->ncols/2) - (long)cutoff));
+}
+
+mzed_prepared_t *mzed_prepared_init(const mzed_t *B) {
+  const gf2e *ff = B->finite_field;
+  mzed_prepared_t *P = (mzed_prepared_t*)m4ri_mm_calloc(1, sizeof(mzed_prepared_t));
+  P->finite_field = ff;
+  P->nrows = B->nrows;
+  P->ncols = B->ncols;
+  P->B = mzed_copy(NULL, B);
+  P->Bs = mzed_slice(NULL, B);
+
+  /* both parts of a table plus e rows of scratch per row of B */
+  const size_t njt_size = (size_t)B->nrows * (njt_mzed_rows(ff) + ff->degree) * B->x->width * sizeof(word);
+  if (B->nrows > 0 && njt_size <= __M4RIE_PREPARED_NJT_CUTOFF && _mzed_prepared_base_case(B)) {
+    P->T = (njt_mzed_t**)m4ri_mm_malloc(B->nrows * sizeof(njt_mzed_t*));
+    for(rci_t i=0; i<B->nrows; i++)
+      P->T[i] = mzed_make_table(NULL, B, i, 0);
+  }
+
+  /* the number of rows of A is not known yet */
+  if (B->nrows > 0 && m4rie_profile_use_blm(ff, B->nrows, B->nrows, B->ncols)) {
+    P->f = blm_cache_get_field(ff);
+    P->GB = _mzd_ptr_blm_prepare((const mzd_t**)P->Bs->x, P->f);
+  }
+  return P;
+}
+
+void mzed_prepared_free(mzed_prepared_t *P) {
+  if (P->GB)
+    _mzd_ptr_blm_prepared_free(P->GB, P->f);
+  if (P->T) {
+    for(rci_t i=0; i<P->nrows; i++)
+      njt_mzed_free(P->T[i]);
+    m4ri_mm_free(P->T);
+  }
+  mzd_slice_free(P->Bs);
+  mzed_free(P->B);
+  m4ri_mm_free(P);
+}
+
+static mzed_t *_mzed_prepared_run(mzed_t *C, const mzed_t *A, const mzed_prepared_t *P, const int addmul) {
+  if (m4rie_profile_use_karatsuba(A->finite_field, A->nrows, A->ncols, P->ncols)) {
+    if (addmul)
+      return _mzed_addmul_karatsuba_prepared(C, A, P, __M4RIE_KARATSUBA_TILE);
+    else
+      return _mzed_mul_karatsuba_prepared(C, A, P, __M4RIE_KARATSUBA_TILE);
+  }
+
+  /* C was cleared for C = A*B */
+  if (P->T)
+    return _mzed_mul_newton_john_prepared(C, A, P->T);
+
+  const rci_t cutoff = _mzed_strassen_cutoff(C, A, P->B);
+  if (addmul)
+    return _mzed_addmul_strassen(C, A, P->B, cutoff);
+  else
+    return _mzed_mul_strassen(C, A, P->B, cutoff);
+}
+
+mzed_t *mzed_mul_prepared(mzed_t *C, const mzed_t *A, const mzed_prepared_t *P) {
+  C = _mzed_mul_init(C, A, P->B, TRUE);
+  return _mzed_prepared_run(C, A, P, 0);
+}
+
+mzed_t *mzed_addmul_prepared(mzed_t *C, const mzed_t *A, const mzed_prepared_t *P) {
+  C = _mzed_mul_init(C, A, P->B, FALSE);
+  return _mzed_prepared_run(C, A, P, 1);
+}
+
+mzd_slice_t *_mzd_slice_addmul_prepared(mzd_slice_t *C, const mzd_slice_t *A, const mzed_prepared_t *P, rci_t r0, rci_t c0) {
+  const gf2e *ff = A->finite_field;
+  const rci_t r1 = r0 + A->ncols;
+  const rci_t c1 = c0 + C->ncols;
+
+  if (P->GB != NULL && m4rie_profile_use_blm(ff, A->nrows, A->ncols, C->ncols)) {
+    const rci_t len = P->f->G->nrows;
+    mzd_t **GB = (mzd_t**)m4ri_mm_malloc(len * sizeof(mzd_t*));
+    for(rci_t i=0; i<len; i++)
+      GB[i] = mzd_init_window(P->GB[i], r0, c0, r1, c1);
+
+    mzd_slice_t *T = _mzd_slice_init_scratch(ff, C->nrows, C->ncols);
+    _mzd_ptr_apply_blm_prepared(T->x, (const mzd_t**)A->x, (const mzd_t**)GB, P->f);
+    mzd_slice_add(C, C, T);
+    _mzd_slice_free_scratch(T);
+
+    for(rci_t i=0; i<len; i++)
+      mzd_free_window(GB[i]);
+    m4ri_mm_free(GB);
+  } else {
+    mzd_slice_t *Bw = mzd_slice_init_window(P->Bs, r0, c0, r1, c1);
+    _mzd_slice_addmul_karatsuba(C, A, Bw);
+    mzd_slice_free_window(Bw);
+  }
+  return C;
+}
+
+mzd_slice_t *mzd_slice_mul_prepared(mzd_slice_t *C, const mzd_slice_t *A, const mzed_prepared_t *P) {
+  if (A->ncols != P->nrows || A->finite_field != P->finite_field)
+    m4ri_die("mzd_slice_mul_prepared: rows, columns and fields must match.\n");
+  if (C == NULL) {
+    C = mzd_slice_init(A->finite_field, A->nrows, P->ncols);
+  } else {
+    if (C->finite_field != A->finite_field || C->nrows != A->nrows || C->ncols != P->ncols)
+      m4ri_die("mzd_slice_mul_prepared: rows and columns of returned matrix must match.\n");
+    mzd_slice_set_ui(C, 0);
+  }
+  return _mzd_slice_addmul_prepared(C, A, P, 0, 0);
+}
+
+mzd_slice_t *mzd_slice_addmul_prepared(mzd_slice_t *C, const mzd_slice_t *A, const mzed_prepared_t *P) {
+  if (A->ncols != P->nrows || A->finite_field != P->finite_field)
+    m4ri_die("mzd_slice_addmul_prepared: rows, columns and fields must match.\n");
+  if (C->finite_field != A->finite_field || C->nrows != A->nrows || C->ncols != P->ncols)
+    m4ri_die("mzd_slice_addmul_prepared: rows and columns of returned matrix must match.\n");
+  return _mzd_slice_addmul_prepared(C, A, P, 0, 0);
+}
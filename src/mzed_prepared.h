@@ -0,0 +1,151 @@
+/**
+ * \file mzed_prepared.h
+ *
+ * \brief Right operands which are multiplied by many left operands
+ *
+ * Every product A*B converts B to bitsliced representation if Karatsuba is used, builds
+ * Newton-John tables for all rows of B if Newton-John is used and computes the linear
+ * combinations G*B of the slices of B if bilinear maps are used. All of these only depend on B.
+ * A mzed_prepared_t computes them once, so that products with many different A only do the work
+ * which depends on A.
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_MZED_PREPARED_H
+#define M4RIE_MZED_PREPARED_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <m4ri/m4ri.h>
+#include <m4rie/mzed.h>
+#include <m4rie/mzd_slice.h>
+#include <m4rie/newton_john.h>
+#include <m4rie/blm.h>
+
+/**
+ * \brief Maximal number of bytes of Newton-John tables mzed_prepared_init() builds.
+ */
+
+#define __M4RIE_PREPARED_NJT_CUTOFF (1<<25)
+
+/**
+ * \brief A right operand B with everything products A*B need which only depends on B.
+ *
+ * \ingroup Definitions
+ */
+
+typedef struct {
+  const gf2e *finite_field; /**< Finite field of B. */
+  rci_t nrows;              /**< Number of rows of B. */
+  rci_t ncols;              /**< Number of columns of B. */
+  mzed_t *B;                /**< Copy of B. */
+  mzd_slice_t *Bs;          /**< B in bitsliced representation. */
+  njt_mzed_t **T;           /**< Newton-John tables of all rows of B or NULL. */
+  const blm_t *f;           /**< Bilinear map GB was computed for or NULL. */
+  mzd_t **GB;               /**< G*B for the bilinear map f or NULL, see _mzd_ptr_blm_prepare(). */
+} mzed_prepared_t;
+
+/**
+ * \brief Prepare B for products A*B.
+ *
+ * The bitsliced representation of B is always computed. Newton-John tables are built if products
+ * with B are small enough to be handled by Newton-John tables directly (see
+ * _mzed_strassen_cutoff()) and the tables take at most __M4RIE_PREPARED_NJT_CUTOFF bytes. G*B is
+ * computed if the profile selects bilinear maps for products with B (see
+ * m4rie_profile_use_blm()).
+ *
+ * \param B Matrix, it is copied and may be changed or freed afterwards.
+ *
+ * \sa mzed_mul_prepared() mzd_slice_mul_prepared()
+ */
+
+mzed_prepared_t *mzed_prepared_init(const mzed_t *B);
+
+/**
+ * \brief Free a prepared matrix.
+ *
+ * \param P Prepared matrix.
+ */
+
+void mzed_prepared_free(mzed_prepared_t *P);
+
+/**
+ * \brief \f$C = A \cdot B\f$ where P was prepared from B.
+ *
+ * \param C Preallocated product matrix, may be NULL for automatic creation.
+ * \param A Input matrix A.
+ * \param P Prepared matrix B.
+ *
+ * \ingroup Multiplication
+ */
+
+mzed_t *mzed_mul_prepared(mzed_t *C, const mzed_t *A, const mzed_prepared_t *P);
+
+/**
+ * \brief \f$C = C + A \cdot B\f$ where P was prepared from B.
+ *
+ * \param C Preallocated product matrix.
+ * \param A Input matrix A.
+ * \param P Prepared matrix B.
+ *
+ * \ingroup Multiplication
+ */
+
+mzed_t *mzed_addmul_prepared(mzed_t *C, const mzed_t *A, const mzed_prepared_t *P);
+
+/**
+ * \brief \f$C = C + A \cdot B[r0:r0+l, c0:c0+n]\f$ where P was prepared from B, A is m x l and C
+ * is m x n.
+ *
+ * \param C Preallocated product matrix.
+ * \param A Input matrix A.
+ * \param P Prepared matrix B.
+ * \param r0 First row of B.
+ * \param c0 First column of B, a multiple of m4ri_radix.
+ */
+
+mzd_slice_t *_mzd_slice_addmul_prepared(mzd_slice_t *C, const mzd_slice_t *A, const mzed_prepared_t *P, rci_t r0, rci_t c0);
+
+/**
+ * \brief \f$C = A \cdot B\f$ where P was prepared from B.
+ *
+ * \param C Preallocated product matrix, may be NULL for automatic creation.
+ * \param A Input matrix A.
+ * \param P Prepared matrix B.
+ *
+ * \ingroup Multiplication
+ */
+
+mzd_slice_t *mzd_slice_mul_prepared(mzd_slice_t *C, const mzd_slice_t *A, const mzed_prepared_t *P);
+
+/**
+ * \brief \f$C = C + A \cdot B\f$ where P was prepared from B.
+ *
+ * \param C Preallocated product matrix.
+ * \param A Input matrix A.
+ * \param P Prepared matrix B.
+ *
+ * \ingroup Multiplication
+ */
+
+mzd_slice_t *mzd_slice_addmul_prepared(mzd_slice_t *C, const mzd_slice_t *A, const mzed_prepared_t *P);
+
+#endif //M4RIE_MZED_PREPARED_H
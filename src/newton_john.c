@@ -19,6 +19,12 @@
 
 #include "config.h"
 
+#ifdef HAVE_OPENMP
+#include <omp.h>
+#endif
+
+#include <string.h>
+
 #include <m4ri/misc.h>
 #include <m4ri/mzd.h>
 #include <m4ri/brilliantrussian.h>
@@ -28,74 +34,173 @@
 #include "trsm.h"
 #include "ple.h"
 #include "conversion.h"
+#include "threads.h"
+#include "profile.h"
 
-njt_mzed_t *njt_mzed_init(const gf2e *ff, const rci_t ncols) {
-  njt_mzed_t *T =  m4ri_mm_malloc(sizeof(njt_mzed_t));
-  T->L = (rci_t*)m4ri_mm_calloc(__M4RI_TWOPOW(ff->degree), sizeof(rci_t));
-  T->T = mzed_init(ff, __M4RI_TWOPOW(ff->degree), ncols);
-  T->M = mzed_init(ff, ff->degree, ncols);
+/**
+ * Released tables, most recently released last, and the number of bytes they take.
+ */
+
+typedef struct {
+  njt_mzed_t *T[__M4RIE_NJT_POOL_SIZE];
+  int n;
+  size_t bytes;
+} njt_mzed_pool_t;
+
+/**
+ * Every thread first keeps the tables it releases in a free list of its own, which needs no
+ * synchronisation. Tables which do not fit there go to an overflow shared by all threads, guarded
+ * by the critical section m4rie_njt_pool.
+ */
+
+static njt_mzed_pool_t njt_mzed_pool_local;
+#ifdef HAVE_OPENMP
+#pragma omp threadprivate(njt_mzed_pool_local)
+#endif
+
+static njt_mzed_pool_t njt_mzed_pool_shared;
+
+static inline size_t _njt_mzed_bytes(const njt_mzed_t *T) {
+  size_t rows = T->T->nrows + T->M->nrows;
+  if (T->T1)
+    rows += T->T1->nrows;
+  return rows * T->T->x->width * sizeof(word);
+}
+
+static inline njt_mzed_t *_njt_mzed_pool_take(njt_mzed_pool_t *pool, const int i) {
+  njt_mzed_t *T = pool->T[i];
+  for(int j=i+1; j<pool->n; j++)
+    pool->T[j-1] = pool->T[j];
+  pool->n--;
+  pool->bytes -= _njt_mzed_bytes(T);
   return T;
 }
 
-void njt_mzed_free(njt_mzed_t *T) {
+static inline njt_mzed_t *_njt_mzed_pool_find(njt_mzed_pool_t *pool, const gf2e *ff, const rci_t ncols) {
+  for(int i=pool->n-1; i>=0; i--)
+    if (pool->T[i]->M->nrows == ff->degree && pool->T[i]->M->ncols == ncols)
+      return _njt_mzed_pool_take(pool, i);
+  return NULL;
+}
+
+/**
+ * Append T to the pool, moving the tables released longest ago to drop until there is room for it.
+ */
+
+static inline void _njt_mzed_pool_put(njt_mzed_pool_t *pool, njt_mzed_t *T, const int size, const size_t bytes,
+                                      njt_mzed_t **drop, int *ndrop) {
+  const size_t b = _njt_mzed_bytes(T);
+  if (b > bytes) {
+    drop[(*ndrop)++] = T;
+    return;
+  }
+  while (pool->n == size || pool->bytes + b > bytes)
+    drop[(*ndrop)++] = _njt_mzed_pool_take(pool, 0);
+  pool->T[pool->n++] = T;
+  pool->bytes += b;
+}
+
+static void _njt_mzed_release(njt_mzed_t *T) {
   mzed_free(T->M);
   mzed_free(T->T);
   m4ri_mm_free(T->L);
+  if (T->T1) {
+    mzed_free(T->T1);
+    m4ri_mm_free(T->L1);
+  }
   m4ri_mm_free(T);
 }
 
-/**
- * Compute C[rc,i] = C[rc,i] + T0[r0,i] + ... + T3[r3,i] for 0 <= i < ncols
- *
- * \param C Matrix
- * \apram rc Row index
- * \param T0 Matrix
- * \param r0 Row index
- * \param T1 Matrix
- * \param r1 Row index
- * \param T2 Matrix
- * \param r2 Row index
- * \param T3 Matrix
- * \param r3 Row index
- */
+njt_mzed_t *njt_mzed_init(const gf2e *ff, const rci_t ncols) {
+  /* the shape of a table only depends on the degree, the field is rebound */
+  njt_mzed_t *T = _njt_mzed_pool_find(&njt_mzed_pool_local, ff, ncols);
+  if (T == NULL) {
+#ifdef HAVE_OPENMP
+#pragma omp critical (m4rie_njt_pool)
+#endif
+    T = _njt_mzed_pool_find(&njt_mzed_pool_shared, ff, ncols);
+  }
+
+  if (T != NULL) {
+    T->M->finite_field = ff;
+    T->T->finite_field = ff;
+    if (T->T1)
+      T->T1->finite_field = ff;
+    return T;
+  }
 
-static inline void mzed_combine4(mzed_t *C, rci_t rc, 
-                                 mzed_t *T0, rci_t r0, mzed_t *T1, rci_t r1, mzed_t *T2, rci_t r2, mzed_t *T3, rci_t r3) {
-  const word *t[4] = {T0->x->rows[r0], T1->x->rows[r1], T2->x->rows[r2], T3->x->rows[r3]};
-  _mzd_combine_4(C->x->rows[rc], t, C->x->width);
+  T =  m4ri_mm_malloc(sizeof(njt_mzed_t));
+  if (ff->degree > __M4RIE_NJT_SPLIT) {
+    T->L = (rci_t*)m4ri_mm_calloc(__M4RI_TWOPOW(__M4RIE_NJT_SPLIT), sizeof(rci_t));
+    T->T = mzed_init(ff, __M4RI_TWOPOW(__M4RIE_NJT_SPLIT), ncols);
+    T->L1 = (rci_t*)m4ri_mm_calloc(__M4RI_TWOPOW(ff->degree - __M4RIE_NJT_SPLIT), sizeof(rci_t));
+    T->T1 = mzed_init(ff, __M4RI_TWOPOW(ff->degree - __M4RIE_NJT_SPLIT), ncols);
+  } else {
+    T->L = (rci_t*)m4ri_mm_calloc(__M4RI_TWOPOW(ff->degree), sizeof(rci_t));
+    T->T = mzed_init(ff, __M4RI_TWOPOW(ff->degree), ncols);
+    T->L1 = NULL;
+    T->T1 = NULL;
+  }
+  T->M = mzed_init(ff, ff->degree, ncols);
+  T->zero = T->T->x->width;
+  return T;
 }
 
-/**
- * Compute C[rc,i] = C[rc,i] + T0[r0,i] + ... + T7[r7,i] for 0 <= i < ncols
- *
- * \param C Matrix
- * \apram rc Row index
- * \param T0 Matrix
- * \param r0 Row index
- * \param T1 Matrix
- * \param r1 Row index
- * \param T2 Matrix
- * \param r2 Row index
- * \param T3 Matrix
- * \param r3 Row index
- * \param T4 Matrix
- * \param r4 Row index
- * \param T5 Matrix
- * \param r5 Row index
- * \param T6 Matrix
- * \param r6 Row index
- * \param T7 Matrix
- * \param r7 Row index
- */
+void njt_mzed_free(njt_mzed_t *T) {
+  njt_mzed_t *spill[__M4RIE_NJT_LOCAL_SIZE + 1];
+  int nspill = 0;
+  _njt_mzed_pool_put(&njt_mzed_pool_local, T, __M4RIE_NJT_LOCAL_SIZE, __M4RIE_NJT_LOCAL_BYTES, spill, &nspill);
+  if (nspill == 0)
+    return;
+
+  njt_mzed_t *drop[__M4RIE_NJT_POOL_SIZE + __M4RIE_NJT_LOCAL_SIZE + 1];
+  int ndrop = 0;
+#ifdef HAVE_OPENMP
+#pragma omp critical (m4rie_njt_pool)
+#endif
+  {
+    for(int i=0; i<nspill; i++)
+      _njt_mzed_pool_put(&njt_mzed_pool_shared, spill[i], __M4RIE_NJT_POOL_SIZE, __M4RIE_NJT_POOL_BYTES, drop, &ndrop);
+  }
+
+  for(int i=0; i<ndrop; i++)
+    _njt_mzed_release(drop[i]);
+}
+
+static void _njt_mzed_pool_local_clear(void) {
+  while (njt_mzed_pool_local.n)
+    _njt_mzed_release(_njt_mzed_pool_take(&njt_mzed_pool_local, njt_mzed_pool_local.n - 1));
+}
+
+void njt_mzed_pool_clear(void) {
+  /* threadprivate data persists between parallel regions of the same size */
+#ifdef HAVE_OPENMP
+#pragma omp parallel num_threads(m4rie_get_num_threads())
+#endif
+  _njt_mzed_pool_local_clear();
+
+  njt_mzed_t *drop[__M4RIE_NJT_POOL_SIZE];
+  int ndrop = 0;
+#ifdef HAVE_OPENMP
+#pragma omp critical (m4rie_njt_pool)
+#endif
+  {
+    while (njt_mzed_pool_shared.n)
+      drop[ndrop++] = _njt_mzed_pool_take(&njt_mzed_pool_shared, njt_mzed_pool_shared.n - 1);
+  }
 
-static inline void mzed_combine8(mzed_t *C, rci_t rc, 
-                                 mzed_t *T0, rci_t r0, mzed_t *T1, rci_t r1, mzed_t *T2, rci_t r2, mzed_t *T3, rci_t r3,
-                                 mzed_t *T4, rci_t r4, mzed_t *T5, rci_t r5, mzed_t *T6, rci_t r6, mzed_t *T7, rci_t r7) {
-  const word *t[8] = {T0->x->rows[r0], T1->x->rows[r1], T2->x->rows[r2], T3->x->rows[r3], 
-                      T4->x->rows[r4], T5->x->rows[r5], T6->x->rows[r6], T7->x->rows[r7]};
-  _mzd_combine_8(C->x->rows[rc], t, C->x->width);
+  for(int i=0; i<ndrop; i++)
+    _njt_mzed_release(drop[i]);
 }
 
+size_t njt_mzed_pool_size(void) {
+  size_t bytes = njt_mzed_pool_local.bytes;
+#ifdef HAVE_OPENMP
+#pragma omp critical (m4rie_njt_pool)
+#endif
+  bytes += njt_mzed_pool_shared.bytes;
+  return bytes;
+}
 
 /**
  * \brief Perform Gaussian reduction to reduced row echelon form on a
@@ -124,11 +229,9 @@ rci_t _mzed_gauss_submatrix_full(mzed_t *A, const rci_t r, const rci_t c, const
   for (j=c; j<c+k; j++) {
     found = 0;
     for (i=start_row; i< end_row; i++) {
-      /* first we need to clear the first columns */
-      for (l=0; l<j-c; l++) {
-        tmp = mzed_read_elem(A, i, c+l);
-        if (tmp) mzed_add_multiple_of_row(A, i, A, r+l, tmp, c+l);
-      }
+      /* first we need to clear the first columns, rows searched before are clear up to j-1 */
+      for (l=mzed_first_nonzero_in_row(A, i, c, j); l<j; l=mzed_first_nonzero_in_row(A, i, l+1, j))
+        mzed_add_multiple_of_row(A, i, A, r+(l-c), mzed_read_elem(A, i, l), l);
       /* pivot? */
       const word x = mzed_read_elem(A, i, j);
       if (x) {
@@ -153,42 +256,34 @@ rci_t _mzed_gauss_submatrix_full(mzed_t *A, const rci_t r, const rci_t c, const
 }
 
 
-njt_mzed_t *mzed_make_table(njt_mzed_t *T, const mzed_t *A, const rci_t r, const rci_t c) {
-  assert(m4ri_radix > A->finite_field->degree);
-  if (T == NULL)
-    T = njt_mzed_init(A->finite_field, A->ncols);
+/**
+ * Clear the words [start, stop) of all rows of T.
+ */
 
-  mzd_set_ui(T->M->x,0);
+static inline void _mzed_clear_words(mzed_t *T, const wi_t start, const wi_t stop) {
+  for(rci_t i=0; i<T->nrows; i++)
+    memset(T->x->rows[i] + start, 0, (stop - start) * sizeof(word));
+}
 
-#if 0
-  for(rci_t i=0; i< T->T->nrows; i+=2) {
-    T->L[i] = i;
-    mzed_add_multiple_of_row(T->T, i, A, r, A->finite_field->mul[i], c);
+/**
+ * Fill T with all 2^k linear combinations of the rows m0, ..., m0+k-1 of M from word homeblock on
+ * and set L such that L[a] is the row of the combination with coefficients given by the bits of a.
+ */
 
-    T->L[i+1] = i+1;
-    mzed_copy_row(T->T, i+1, T->T, i);
-    mzed_add_row(T->T, i+1, A, r, c);
-  }
-#else  
-  const int degree = A->finite_field->degree;
-  const wi_t homeblock = A->w*c / m4ri_radix;
-  const wi_t wide = T->M->x->width - homeblock;
-  const word bitmask_end = T->M->x->high_bitmask;
+static void _mzed_make_table_gray(mzed_t *T, rci_t *L, const mzed_t *M, const int m0, const int k, const wi_t homeblock) {
+  const wi_t wide = T->x->width - homeblock;
+  const word bitmask_end = T->x->high_bitmask;
   wi_t j;
 
-  for(int i=0; i<degree; i++) {
-    mzed_add_multiple_of_row(T->M, i, A, r, 1ULL<<i, c);
-  }
+  for(rci_t i=1; i < __M4RI_TWOPOW(k); ++i) {
+    word *ti = T->x->rows[i] + homeblock;
+    word *ti1 = T->x->rows[i-1] + homeblock;
 
-  for(rci_t i=1; i < T->T->nrows; ++i) {
-    word *ti = T->T->x->rows[i] + homeblock;
-    word *ti1 = T->T->x->rows[i-1] + homeblock;
+    const rci_t rowneeded = m0 + m4ri_codebook[k]->inc[i - 1];
+    const int id = m4ri_codebook[k]->ord[i];
+    L[id] = i;
 
-    const rci_t rowneeded = m4ri_codebook[degree]->inc[i - 1];
-    const int id = m4ri_codebook[degree]->ord[i];
-    T->L[id] = i;
-
-    word *m = T->M->x->rows[rowneeded] + homeblock;
+    word *m = M->x->rows[rowneeded] + homeblock;
 
     /* there might still be stuff left over from the previous table creation,
        here we assume that this is at most 8 * m4ri_radix bits away. */
@@ -227,40 +322,153 @@ njt_mzed_t *mzed_make_table(njt_mzed_t *T, const mzed_t *A, const rci_t r, const
     case 1:  *ti++ = (*m++ ^ *ti1++) & bitmask_end;
     }
   }
+}
+
+/**
+ * b = x*a for n words of packed elements of A. Every element is shifted up by one bit and, if
+ * its top bit was set, reduced by the minimal polynomial. No bits carry over to the next element.
+ */
+
+static inline void _mzed_mul_by_x(word *b, const word *a, const mzed_t *A, const wi_t n) {
+  const int e = A->finite_field->degree;
+  const word ones = m4ri_ffff / __M4RI_LEFT_BITMASK(A->w);
+  const word red = A->finite_field->minpoly ^ __M4RI_TWOPOW(e);
+  for(wi_t j=0; j<n; j++) {
+    const word hi = (a[j] >> (e-1)) & ones;
+    b[j] = ((a[j] ^ (hi << (e-1))) << 1) ^ (hi * red);
+  }
+}
+
+njt_mzed_t *mzed_make_table(njt_mzed_t *T, const mzed_t *A, const rci_t r, const rci_t c) {
+  assert(m4ri_radix > A->finite_field->degree);
+  if (T == NULL)
+    T = njt_mzed_init(A->finite_field, A->ncols);
+
+  mzd_set_ui(T->M->x,0);
+
+#if 0
+  for(rci_t i=0; i< T->T->nrows; i+=2) {
+    T->L[i] = i;
+    mzed_add_multiple_of_row(T->T, i, A, r, A->finite_field->mul[i], c);
+
+    T->L[i+1] = i+1;
+    mzed_copy_row(T->T, i+1, T->T, i);
+    mzed_add_row(T->T, i+1, A, r, c);
+  }
+#else  
+  const int degree = A->finite_field->degree;
+  const wi_t homeblock = A->w*c / m4ri_radix;
+
+  /* rows are only written from homeblock on, words before it may be left from an earlier use of a
+     pooled table */
+  if (T->zero < homeblock) {
+    _mzed_clear_words(T->T, T->zero, homeblock);
+    if (T->T1)
+      _mzed_clear_words(T->T1, T->zero, homeblock);
+  }
+  T->zero = homeblock;
+
+  mzed_add_row(T->M, 0, A, r, c);
+  for(int i=1; i<degree; i++)
+    _mzed_mul_by_x(T->M->x->rows[i] + homeblock, T->M->x->rows[i-1] + homeblock, A, T->M->x->width - homeblock);
+
+  if (T->T1 == NULL) {
+    _mzed_make_table_gray(T->T, T->L, T->M, 0, degree, homeblock);
+  } else {
+    _mzed_make_table_gray(T->T, T->L, T->M, 0, __M4RIE_NJT_SPLIT, homeblock);
+    _mzed_make_table_gray(T->T1, T->L1, T->M, __M4RIE_NJT_SPLIT, degree - __M4RIE_NJT_SPLIT, homeblock);
+  }
 #endif
 
   return T;
 }
 
-rci_t mzed_echelonize_newton_john(mzed_t *A, int full) {
-  const gf2e* ff = A->finite_field;
+/**
+ * c ^= t[0] ^ ... ^ t[n-1] for 0 < n <= 8 rows of width words.
+ */
 
-  rci_t r,c;
+static inline void _mzed_combine_n(word *c, word const **t, const int n, const wi_t width) {
+  int i = 0;
+  if (n - i >= 8) { _mzd_combine_8(c, t + i, width); i += 8; }
+  if (n - i >= 4) { _mzd_combine_4(c, t + i, width); i += 4; }
+  if (n - i >= 2) { _mzd_combine_2(c, t + i, width); i += 2; }
+  if (n - i >= 1) {
+    word const *t0 = t[i];
+    for(wi_t k=0; k<width; k++)
+      c[k] ^= t0[k];
+  }
+}
 
-  rci_t k = ff->degree;
+/**
+ * Number of pivots between 1 and 6 mzed_echelonize_newton_john() and mzed_ple_newton_john()
+ * handle with one pass over the remaining rows, cf. mzd_echelonize_m4ri().
+ */
 
-  /* cf. mzd_echelonize_m4ri */
+static rci_t _mzed_newton_john_kk(const mzed_t *A) {
   rci_t kk = (rci_t)m4ri_opt_k(A->x->nrows, A->x->ncols, 0);
   if (kk>=7)
     kk = 7;
   if ( (6*(1<<kk)*A->ncols / 8.0) > __M4RI_CPU_L2_CACHE / 2.0 )
     kk -= 1;
-  kk = (6*kk)/k;
+  kk = (6*kk)/A->finite_field->degree;
 
   /* enforcing bounds */
   if (kk == 0)
     kk = 1;
   else if (kk > 6)
     kk = 6;
+  return kk;
+}
+
+/**
+ * Apply mzed_process_rows{,2,...,6}() with the tables T[0], ..., T[kbar-1] to the rows [startrow,
+ * endrow). The tables are only read and every row is updated on its own, so blocks of rows are
+ * processed by different threads if this is worthwhile.
+ */
+
+static void _mzed_process_rows_n(mzed_t *A, const rci_t startrow, const rci_t endrow, const rci_t startcol,
+                                 njt_mzed_t *const *T, const int kbar) {
+  int nthreads = 1;
+  if (m4rie_parallel_worthwhile(endrow - startrow, A->x->ncols, kbar*A->w))
+    nthreads = m4rie_get_num_threads();
+  const rci_t blocksize = (endrow - startrow + nthreads - 1)/nthreads;
+
+#ifdef HAVE_OPENMP
+#pragma omp parallel for schedule(static) num_threads(nthreads) if(nthreads > 1)
+#endif
+  for(int t=0; t<nthreads; t++) {
+    const rci_t r0 = startrow + t*blocksize;
+    const rci_t r1 = MIN(r0 + blocksize, endrow);
+    if (r0 >= r1)
+      continue;
+    switch(kbar) {
+    case 1: mzed_process_rows (A, r0, r1, startcol, T[0]); break;
+    case 2: mzed_process_rows2(A, r0, r1, startcol, T[0], T[1]); break;
+    case 3: mzed_process_rows3(A, r0, r1, startcol, T[0], T[1], T[2]); break;
+    case 4: mzed_process_rows4(A, r0, r1, startcol, T[0], T[1], T[2], T[3]); break;
+    case 5: mzed_process_rows5(A, r0, r1, startcol, T[0], T[1], T[2], T[3], T[4]); break;
+    case 6: mzed_process_rows6(A, r0, r1, startcol, T[0], T[1], T[2], T[3], T[4], T[5]); break;
+    }
+  }
+}
+
+rci_t mzed_echelonize_newton_john(mzed_t *A, int full) {
+  const gf2e* ff = A->finite_field;
+
+  rci_t r,c,i;
+
+  rci_t k = ff->degree;
+
+  rci_t kk = _mzed_newton_john_kk(A);
+  /* split tables take two slots of mzd_process_rows6() each */
+  if (k > __M4RIE_NJT_SPLIT && kk > 3)
+    kk = 3;
 
   rci_t kbar = 0;
 
-  njt_mzed_t *T0 = njt_mzed_init(ff, A->ncols);
-  njt_mzed_t *T1 = njt_mzed_init(ff, A->ncols);
-  njt_mzed_t *T2 = njt_mzed_init(ff, A->ncols);
-  njt_mzed_t *T3 = njt_mzed_init(ff, A->ncols);
-  njt_mzed_t *T4 = njt_mzed_init(ff, A->ncols);
-  njt_mzed_t *T5 = njt_mzed_init(ff, A->ncols);
+  njt_mzed_t *T[6];
+  for(int s=0; s<6; s++)
+    T[s] = njt_mzed_init(ff, A->ncols);
 
   r = 0;
   c = 0;
@@ -274,114 +482,130 @@ rci_t mzed_echelonize_newton_john(mzed_t *A, int full) {
      */
     kbar = _mzed_gauss_submatrix_full(A, r, c, A->nrows, kk);
 
-    if (kbar == 6)  {
-      mzed_make_table(T0, A, r,   c);
-      mzed_make_table(T1, A, r+1, c+1);
-      mzed_make_table(T2, A, r+2, c+2);
-      mzed_make_table(T3, A, r+3, c+3);
-      mzed_make_table(T4, A, r+4, c+4);
-      mzed_make_table(T5, A, r+5, c+5);
+    if (kbar > 0) {
+      for(int s=0; s<kbar; s++)
+        mzed_make_table(T[s], A, r+s, c+s);
       if(kbar == kk)
-        mzed_process_rows6( A, r+6, A->nrows, c, T0, T1, T2, T3, T4, T5);
+        _mzed_process_rows_n(A, r+kbar, A->nrows, c, T, kbar);
       if(full)
-        mzed_process_rows6( A,   0,        r, c, T0, T1, T2, T3, T4, T5);
-    } else if(kbar == 5) {
-      mzed_make_table(T0, A, r,     c);
-      mzed_make_table(T1, A, r+1, c+1);
-      mzed_make_table(T2, A, r+2, c+2);
-      mzed_make_table(T3, A, r+3, c+3);
-      mzed_make_table(T4, A, r+4, c+4);
-      if(kbar == kk)
-        mzed_process_rows5( A, r+5, A->nrows, c, T0, T1, T2, T3, T4);
-      if(full)
-        mzed_process_rows5( A,   0,        r, c, T0, T1, T2, T3, T4);
-
-    } else if(kbar == 4) {
-      mzed_make_table(T0, A, r,   c);
-      mzed_make_table(T1, A, r+1, c+1);
-      mzed_make_table(T2, A, r+2, c+2);
-      mzed_make_table(T3, A, r+3, c+3);
-      if(kbar == kk)
-        mzed_process_rows4( A, r+4, A->nrows, c, T0, T1, T2, T3);
-      if(full)
-        mzed_process_rows4( A,   0,        r, c, T0, T1, T2, T3);
-
-    } else if(kbar == 3) {
-      mzed_make_table(T0,  A, r,   c );
-      mzed_make_table(T1,  A, r+1, c+1);
-      mzed_make_table(T2,  A, r+2, c+2);
-      if(kbar == kk)
-        mzed_process_rows3( A, r+3, A->nrows, c, T0, T1, T2);
-      if(full)
-        mzed_process_rows3( A,   0,        r, c, T0, T1, T2);
-
-    } else if(kbar == 2) {
-      mzed_make_table(T0, A, r,   c );
-      mzed_make_table(T1, A, r+1, c+1);
-      if(kbar == kk)
-        mzed_process_rows2( A, r+2, A->nrows, c, T0, T1);
-      if(full)
-        mzed_process_rows2( A,   0,        r, c, T0, T1);
-
-    } else if (kbar == 1) {
-      mzed_make_table(T0, A, r, c);
-      if(kbar == kk)
-        mzed_process_rows( A, r+1, A->nrows, c, T0);
-      if(full)
-        mzed_process_rows( A,   0,        r, c, T0);
-
+        _mzed_process_rows_n(A,      0,        r, c, T, kbar);
     } else {
-      c++;
+      /* column c is zero below row r, move on to the next non-zero column */
+      if (!mzed_find_pivot(A, r, c+1, A->ncols, NULL, &i, &c))
+        break;
     }
     r += kbar;
     c += kbar;
   }
 
-  njt_mzed_free(T0);
-  njt_mzed_free(T1);
-  njt_mzed_free(T2);
-  njt_mzed_free(T3);
-  njt_mzed_free(T4);
-  njt_mzed_free(T5);
+  for(int s=0; s<6; s++)
+    njt_mzed_free(T[s]);
   return r;
 }
 
+/**
+ * A[i] = A[i] + sum_s A[i,pc[s]] * A[r+s] for startrow <= i < endrow and from column startcol on,
+ * where T[s] is the Newton-John table of row r+s from column startcol on and startcol is at a word
+ * boundary.
+ */
+
+static void _mzed_ple_process_rows(mzed_t *A, const rci_t startrow, const rci_t endrow, const rci_t startcol,
+                                   njt_mzed_t **T, const rci_t *pc, const int kbar) {
+  const wi_t off = (A->w * startcol) / m4ri_radix;
+  const wi_t width = A->x->width - off;
+
+  /* the tables are only read, as in _mzed_process_rows_n() */
+  int nthreads = 1;
+  if (m4rie_parallel_worthwhile(endrow - startrow, A->x->ncols, kbar*A->w))
+    nthreads = m4rie_get_num_threads();
+
+#ifdef HAVE_OPENMP
+#pragma omp parallel for schedule(static) num_threads(nthreads) if(nthreads > 1)
+#endif
+  for(rci_t i=startrow; i<endrow; i++) {
+    word const *t[12];
+    int n = 0;
+    for(int s=0; s<kbar; s++) {
+      const word a = mzed_read_elem(A, i, pc[s]);
+      if (a == 0)
+        continue;
+      if (T[s]->T1 == NULL) {
+        t[n++] = T[s]->T->x->rows[T[s]->L[a]] + off;
+      } else {
+        t[n++] = T[s]->T->x->rows[T[s]->L[a & __M4RI_LEFT_BITMASK(__M4RIE_NJT_SPLIT)]] + off;
+        t[n++] = T[s]->T1->x->rows[T[s]->L1[a >> __M4RIE_NJT_SPLIT]] + off;
+      }
+    }
+    for(int u=0; u<n; u+=8)
+      _mzed_combine_n(A->x->rows[i] + off, t + u, MIN(8, n - u), width);
+  }
+}
+
 rci_t mzed_ple_newton_john(mzed_t *A, mzp_t *P, mzp_t *Q) {
   rci_t col_pos = 0;
   rci_t row_pos = 0;
   word tmp = 0;
   const gf2e *ff = A->finite_field;
   rci_t i,j;
-  int found = 0;
+  rci_t *first = (rci_t*)m4ri_mm_calloc(A->nrows, sizeof(rci_t));
 
-  njt_mzed_t *T0 = njt_mzed_init(A->finite_field, A->ncols);
+  const int kk = _mzed_newton_john_kk(A);
+  const rci_t per_word = m4ri_radix / A->w;
+  rci_t pc[6];
+
+  njt_mzed_t *T[6];
+  for(int s=0; s<kk; s++)
+    T[s] = njt_mzed_init(ff, A->ncols);
+  njt_mzed_t *Tw = NULL;
 
   while (row_pos < A->nrows && col_pos < A->ncols) {
-    found = 0;
-    for(j=col_pos; j<A->ncols; j++) {
-      for(i=row_pos; i<A->nrows; i++) {
-        if( (tmp = mzed_read_elem(A, i,j)) != 0) {
-          found = 1;
-          break;
-        }
-      }
-      if (found)
+    /**
+     * Up to kk pivots are searched for in the columns [col_pos, ce) as in mzed_ple_naive(). Only
+     * these columns are eliminated right away, the pivot rows are brought up to date when they are
+     * found and all other rows once with Newton-John tables of the pivot rows.
+     */
+    const rci_t r = row_pos;
+    const rci_t c0 = (col_pos / per_word) * per_word;
+    const rci_t ce = MIN(A->ncols, ((col_pos + kk + per_word - 1) / per_word) * per_word);
+    mzed_t *W = mzed_init_window(A, 0, c0, A->nrows, ce);
+    int kbar = 0;
+
+    while (kbar < kk && row_pos < A->nrows && col_pos < ce) {
+      if (!mzed_find_pivot(A, row_pos, col_pos, ce, first, &i, &j)) {
+        col_pos = ce;
         break;
-    }
-    if (found) {
+      }
+      tmp = mzed_read_elem(A, i, j);
       P->values[row_pos] = i;
       Q->values[row_pos] = j;
       mzed_row_swap(A, row_pos, i);
+      first[i] = first[row_pos]; /* row_pos is not searched again */
 
-      if (j+1 < A->ncols) {
+      if (ce < A->ncols) {
+        for(int s=0; s<kbar; s++)
+          mzed_add_multiple_of_row(A, row_pos, A, r+s, mzed_read_elem(A, row_pos, pc[s]), ce);
+      }
+      if (j+1 < A->ncols)
         mzed_rescale_row(A, row_pos, j+1, gf2e_inv(ff, tmp));
-        mzed_make_table(T0, A, row_pos, j+1);
-        mzed_process_rows(A, row_pos+1, A->nrows, j, T0);
+      if (j+1 < ce) {
+        if (Tw == NULL || Tw->T->ncols != W->ncols) {
+          if (Tw)
+            njt_mzed_free(Tw);
+          Tw = njt_mzed_init(ff, W->ncols);
+        }
+        mzed_make_table(Tw, W, row_pos, j+1-c0);
+        mzed_process_rows(W, row_pos+1, A->nrows, j-c0, Tw);
       }
+      pc[kbar++] = j;
       row_pos++;
       col_pos = j + 1;
-    } else {
-      break;
+    }
+    mzed_free_window(W);
+
+    if (kbar > 0 && ce < A->ncols && row_pos < A->nrows) {
+      for(int s=0; s<kbar; s++)
+        mzed_make_table(T[s], A, r+s, ce);
+      _mzed_ple_process_rows(A, row_pos, A->nrows, ce, T, pc, kbar);
     }
   }
   for (rci_t i = row_pos; i < A->nrows; ++i)
@@ -391,7 +615,11 @@ rci_t mzed_ple_newton_john(mzed_t *A, mzp_t *P, mzp_t *Q) {
   for (rci_t i=0; i < row_pos; i++) {
     mzed_col_swap_in_rows(A, i, Q->values[i], i, A->nrows);
   }
-  njt_mzed_free(T0);
+  for(int s=0; s<kk; s++)
+    njt_mzed_free(T[s]);
+  if (Tw)
+    njt_mzed_free(Tw);
+  m4ri_mm_free(first);
 
   return row_pos;
 }
@@ -403,98 +631,205 @@ mzed_t *_mzed_mul_newton_john0(mzed_t *C, const mzed_t *A, const mzed_t *B) {
   for(rci_t i=0; i < A->ncols; i++) {
     mzed_make_table(T0, B, i, 0);
     for(rci_t j=0; j<A->nrows; j++)
-      mzd_combine(C->x, j, 0, C->x, j, 0, T0->T->x, T0->L[mzed_read_elem(A, j, i)], 0);
+      njt_mzed_addmul_row(C, j, T0, mzed_read_elem(A, j, i));
   }
   njt_mzed_free(T0);
   return C;
 }
 
+/**
+ * Number kk of Newton-John tables built at once and width in words of the strips of B they are
+ * built for, such that kk tables of one strip fill half of the L2 cache, leaving the rest to rows
+ * of A and C. Strips are at least __M4RIE_NJT_MIN_STRIP words wide. If this is too wide for eight
+ * tables (four split tables), fewer tables are built at once, but only if there are more rows of
+ * A than rows in a table. Otherwise most rows of a table are never read, building it dominates and
+ * the L2 cache does not help.
+ */
+
+static void _mzed_newton_john_blocking(const mzed_t *A, const mzed_t *B, int *kk, wi_t *strip) {
+  const size_t rows = njt_mzed_rows(B->finite_field);
+  const size_t budget = __M4RI_CPU_L2_CACHE/2;
+  int k = (B->finite_field->degree > __M4RIE_NJT_SPLIT) ? 4 : 8;
+  if ((size_t)A->nrows > rows)
+    while (k > 1 && k * rows * __M4RIE_NJT_MIN_STRIP * sizeof(word) > budget)
+      k /= 2;
+  const wi_t s = budget / (k * rows * sizeof(word));
+  *kk = k;
+  *strip = MIN(MAX(s, __M4RIE_NJT_MIN_STRIP), B->x->width);
+}
+
 mzed_t *_mzed_mul_newton_john(mzed_t *C, const mzed_t *A, const mzed_t *B) {
   if (A->finite_field->degree > A->nrows)
     return _mzed_mul_naive(C, A, B);
+  if (A->nrows == 0 || A->ncols == 0 || B->ncols == 0)
+    return C;
+
+  const gf2e *ff = B->finite_field;
+  const wi_t width = C->x->width;
+  int kk;
+  wi_t strip;
+  _mzed_newton_john_blocking(A, B, &kk, &strip);
+
+  /* threads own strips of C, so there should be at least one strip per thread */
+  int nthreads = 1;
+  if (m4rie_parallel_worthwhile(A->nrows, A->x->ncols, B->x->ncols)) {
+    nthreads = m4rie_get_num_threads();
+    strip = MIN(strip, (width + nthreads - 1)/nthreads);
+  }
 
-  njt_mzed_t *T0 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T1 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T2 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T3 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T4 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T5 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T6 = njt_mzed_init(B->finite_field, B->ncols);
-  njt_mzed_t *T7 = njt_mzed_init(B->finite_field, B->ncols);
-  
-  const rci_t kk = 8;
-  const rci_t end = A->ncols/kk;
-
-  rci_t blocksize = 1ULL<<30;
+  const int epw = m4ri_radix/A->w;  /* entries per word */
+  const word mask = __M4RI_LEFT_BITMASK(A->w);
+  const rci_t sc = strip * epw;  /* columns per strip */
+  const rci_t nstrips = (B->ncols + sc - 1)/sc;
+
+  /* a multiple is the sum of one row of each part of a split table */
+  const int split = (ff->degree > __M4RIE_NJT_SPLIT);
+  const int parts = split ? 2 : 1;
+  const int e0 = split ? __M4RIE_NJT_SPLIT : ff->degree;
+  const int e1 = ff->degree - e0;
+
+  /* rows of the tables holding the multiples A[j, i:i+kk] of the current block of columns of A,
+     computed once for all strips; all tables use the same order of rows, see mzed_make_table() */
+  rci_t *X = (rci_t*)m4ri_mm_malloc((size_t)A->nrows * kk * parts * sizeof(rci_t));
+  rci_t *L0 = (rci_t*)m4ri_mm_calloc(__M4RI_TWOPOW(e0), sizeof(rci_t));
+  rci_t *L1 = (rci_t*)m4ri_mm_calloc(__M4RI_TWOPOW(e1), sizeof(rci_t));
+  for(rci_t i=1; i < __M4RI_TWOPOW(e0); i++)
+    L0[m4ri_codebook[e0]->ord[i]] = i;
+  for(rci_t i=1; i < __M4RI_TWOPOW(e1); i++)
+    L1[m4ri_codebook[e1]->ord[i]] = i;
+
+#ifdef HAVE_OPENMP
+#pragma omp parallel num_threads(nthreads) if(nthreads > 1)
+#endif
+  {
+    njt_mzed_t *T[8];
+    njt_mzed_t *Tl[8];
+    for(int t=0; t<kk; t++) {
+      T[t] = NULL;
+      Tl[t] = NULL;
+    }
 
-  if (A->nrows >= A->w*__M4RI_MUL_BLOCKSIZE) 
-    blocksize = __M4RI_MUL_BLOCKSIZE/A->w; 
+    for(rci_t i=0; i < A->ncols; i += kk) {
+      const int k = MIN(kk, A->ncols - i);
 
-  rci_t giantstep, babystep;
+#ifdef HAVE_OPENMP
+#pragma omp for schedule(static)
+#endif
+      for(rci_t j=0; j < A->nrows; j++) {
+        rci_t *x = X + (size_t)j*kk*parts;
+        /* up to m4ri_radix/w entries are read at once */
+        for(int t=0; t<k; t += epw) {
+          const int n = MIN(k - t, epw);
+          const word a = __mzd_read_bits(A->x, j, A->w*(i+t), A->w*n);
+          for(int u=0; u<n; u++) {
+            const word au = (a >> (A->w*u)) & mask;
+            if (split) {
+              *x++ = L0[au & __M4RI_LEFT_BITMASK(__M4RIE_NJT_SPLIT)];
+              *x++ = L1[au >> __M4RIE_NJT_SPLIT];
+            } else {
+              *x++ = L0[au];
+            }
+          }
+        }
+      }
 
-  for (giantstep=0; giantstep + blocksize <= A->nrows; giantstep += blocksize) {
-    for(rci_t i=0; i < end; i++) {
-      mzed_make_table(T0, B, kk*i  , 0);
-      mzed_make_table(T1, B, kk*i+1, 0);
-      mzed_make_table(T2, B, kk*i+2, 0);
-      mzed_make_table(T3, B, kk*i+3, 0);
-      mzed_make_table(T4, B, kk*i+4, 0);
-      mzed_make_table(T5, B, kk*i+5, 0);
-      mzed_make_table(T6, B, kk*i+6, 0);
-      mzed_make_table(T7, B, kk*i+7, 0);
-      for(babystep = 0; babystep < blocksize; babystep++) {
-        const rci_t j = giantstep + babystep;
-        const rci_t x0 = T0->L[mzed_read_elem(A, j, kk*  i)];
-        const rci_t x1 = T1->L[mzed_read_elem(A, j, kk*i+1)];
-        const rci_t x2 = T2->L[mzed_read_elem(A, j, kk*i+2)];
-        const rci_t x3 = T3->L[mzed_read_elem(A, j, kk*i+3)];
-        const rci_t x4 = T4->L[mzed_read_elem(A, j, kk*i+4)];
-        const rci_t x5 = T5->L[mzed_read_elem(A, j, kk*i+5)];
-        const rci_t x6 = T6->L[mzed_read_elem(A, j, kk*i+6)];
-        const rci_t x7 = T7->L[mzed_read_elem(A, j, kk*i+7)];
-        mzed_combine8(C, j, T0->T, x0, T1->T, x1, T2->T, x2, T3->T, x3, T4->T, x4, T5->T, x5, T6->T, x6, T7->T, x7);
+      /* the implicit barriers of both loops keep X fixed while it is used */
+#ifdef HAVE_OPENMP
+#pragma omp for schedule(static)
+#endif
+      for(rci_t s=0; s < nstrips; s++) {
+        const rci_t c0 = s*sc;
+        const rci_t c1 = MIN(c0 + sc, B->ncols);
+        njt_mzed_t **Ts = (c1 - c0 == sc) ? T : Tl;
+        mzed_t *Bw = mzed_init_window(B, i, c0, i+k, c1);
+        for(int t=0; t<k; t++) {
+          if (Ts[t] == NULL)
+            Ts[t] = njt_mzed_init(ff, c1 - c0);
+          mzed_make_table(Ts[t], Bw, t, 0);
+        }
+        mzed_free_window(Bw);
+
+        const wi_t w0 = s*strip;
+        const wi_t ws = Ts[0]->T->x->width;
+        const int nr = k*parts;
+        word **R[8];
+        for(int u=0; u<k; u++) {
+          R[u*parts] = Ts[u]->T->x->rows;
+          if (split)
+            R[u*parts + 1] = Ts[u]->T1->x->rows;
+        }
+        word const *t[8];
+        for(rci_t j=0; j < A->nrows; j++) {
+          const rci_t *x = X + (size_t)j*kk*parts;
+          for(int u=0; u<nr; u++)
+            t[u] = R[u][x[u]];
+          _mzed_combine_n(C->x->rows[j] + w0, t, nr, ws);
+        }
       }
     }
-  }
 
-  /* last giant step */
-  for(rci_t i=0; i < end; i++) {
-    mzed_make_table(T0, B, kk*i  , 0);
-    mzed_make_table(T1, B, kk*i+1, 0);
-    mzed_make_table(T2, B, kk*i+2, 0);
-    mzed_make_table(T3, B, kk*i+3, 0);
-    mzed_make_table(T4, B, kk*i+4, 0);
-    mzed_make_table(T5, B, kk*i+5, 0);
-    mzed_make_table(T6, B, kk*i+6, 0);
-    mzed_make_table(T7, B, kk*i+7, 0);
-    for(babystep = 0; babystep < A->nrows - giantstep; babystep++) {
-      const rci_t j = giantstep + babystep;
-      const rci_t x0 = T0->L[mzed_read_elem(A, j, kk*  i)];
-      const rci_t x1 = T1->L[mzed_read_elem(A, j, kk*i+1)];
-      const rci_t x2 = T2->L[mzed_read_elem(A, j, kk*i+2)];
-      const rci_t x3 = T3->L[mzed_read_elem(A, j, kk*i+3)];
-      const rci_t x4 = T4->L[mzed_read_elem(A, j, kk*i+4)];
-      const rci_t x5 = T5->L[mzed_read_elem(A, j, kk*i+5)];
-      const rci_t x6 = T6->L[mzed_read_elem(A, j, kk*i+6)];
-      const rci_t x7 = T7->L[mzed_read_elem(A, j, kk*i+7)];
-      mzed_combine8(C, j, T0->T, x0, T1->T, x1, T2->T, x2, T3->T, x3, T4->T, x4, T5->T, x5, T6->T, x6, T7->T, x7);
+    for(int t=0; t<kk; t++) {
+      if (T[t])
+        njt_mzed_free(T[t]);
+      if (Tl[t])
+        njt_mzed_free(Tl[t]);
     }
   }
-  
-  if (A->ncols%kk) {
+
+  m4ri_mm_free(L0);
+  m4ri_mm_free(L1);
+  m4ri_mm_free(X);
+  return C;
+}
+
+mzed_t *_mzed_mul_newton_john_prepared(mzed_t *C, const mzed_t *A, njt_mzed_t *const *T) {
+  /* eight rows are combined at once, two per entry if tables are split */
+  const int split = (A->finite_field->degree > __M4RIE_NJT_SPLIT);
+  const rci_t kk = split ? 4 : 8;
+  const rci_t end = A->ncols/kk;
+
+  rci_t blocksize = A->nrows;
+  if (A->nrows >= A->w*__M4RI_MUL_BLOCKSIZE)
+    blocksize = __M4RI_MUL_BLOCKSIZE/A->w;
+
+  /* tables are read-only, so blocks of rows of C are independent */
+  int nthreads = 1;
+  if (m4rie_parallel_worthwhile(A->nrows, A->x->ncols, C->x->ncols)) {
+    nthreads = m4rie_get_num_threads();
+    blocksize = MIN(blocksize, (A->nrows + nthreads - 1)/nthreads);
+  }
+  const rci_t nblocks = (blocksize > 0) ? (A->nrows + blocksize - 1)/blocksize : 0;
+
+#ifdef HAVE_OPENMP
+#pragma omp parallel for schedule(static) num_threads(nthreads) if(nthreads > 1)
+#endif
+  for(rci_t b=0; b < nblocks; b++) {
+    const rci_t j0 = b*blocksize;
+    const rci_t j1 = MIN(j0 + blocksize, A->nrows);
+    for(rci_t i=0; i < end; i++) {
+      njt_mzed_t *const *Ti = T + kk*i;
+      for(rci_t j=j0; j < j1; j++) {
+        word const *t[8];
+        for(int u=0; u < kk; u++) {
+          const word a = mzed_read_elem(A, j, kk*i+u);
+          if (split) {
+            t[2*u  ] = Ti[u]->T->x->rows[Ti[u]->L[a & __M4RI_LEFT_BITMASK(__M4RIE_NJT_SPLIT)]];
+            t[2*u+1] = Ti[u]->T1->x->rows[Ti[u]->L1[a >> __M4RIE_NJT_SPLIT]];
+          } else {
+            t[u] = Ti[u]->T->x->rows[Ti[u]->L[a]];
+          }
+        }
+        _mzd_combine_8(C->x->rows[j], t, C->x->width);
+      }
+    }
     for(rci_t i=kk*end; i < A->ncols; i++) {
-      mzed_make_table(T0, B, i, 0);
-      for(rci_t j=0; j<A->nrows; j++)
-        mzd_combine(C->x, j, 0, C->x, j, 0, T0->T->x, T0->L[mzed_read_elem(A, j, i)], 0);
+      for(rci_t j=j0; j < j1; j++)
+        njt_mzed_addmul_row(C, j, T[i], mzed_read_elem(A, j, i));
     }
   }
-
-  njt_mzed_free(T0); njt_mzed_free(T1);  njt_mzed_free(T2); njt_mzed_free(T3);
-  njt_mzed_free(T4); njt_mzed_free(T5);  njt_mzed_free(T6); njt_mzed_free(T7);
   return C;
 }
 
-
 mzed_t *mzed_mul_newton_john(mzed_t *C, const mzed_t *A, const mzed_t *B) {
   C = _mzed_mul_init(C,A,B, TRUE);
   return _mzed_mul_newton_john(C, A, B);
@@ -520,13 +855,23 @@ mzed_t *mzed_invert_newton_john(mzed_t *B, const mzed_t *A) {
   return B;
 }
 
+/**
+ * Number of rows up to which the Newton-John TRSM functions call the naive ones, building a table
+ * per row does not pay off for fewer rows than a table has.
+ */
+
+static inline rci_t _mzed_trsm_newton_john_cutoff(const gf2e *ff) {
+  const rci_t c = m4rie_profile_get()->trsm_newton_john[ff->degree];
+  return (c > 0) ? c : njt_mzed_rows(ff);
+}
+
 void mzed_trsm_lower_left_newton_john(const mzed_t *L, mzed_t *B) {
   assert(L->finite_field == B->finite_field);
   assert(L->nrows == L->ncols);
   assert(B->nrows == L->ncols);
 
   const gf2e *ff = L->finite_field;
-  if (__M4RI_TWOPOW(ff->degree) >= L->nrows) {
+  if (_mzed_trsm_newton_john_cutoff(ff) >= L->nrows) {
     mzed_trsm_lower_left_naive(L, B);
     return;
   }
@@ -537,7 +882,7 @@ void mzed_trsm_lower_left_newton_john(const mzed_t *L, mzed_t *B) {
     mzed_rescale_row(B, i, 0, gf2e_inv(ff, mzed_read_elem(L, i, i)));
     mzed_make_table(T0, B, i, 0);
     for(rci_t j=i+1; j<B->nrows; j++)
-      mzd_combine(B->x, j, 0, B->x, j, 0, T0->T->x, T0->L[mzed_read_elem(L, j, i)], 0);
+      njt_mzed_addmul_row(B, j, T0, mzed_read_elem(L, j, i));
   }
   njt_mzed_free(T0);
 }
@@ -548,7 +893,7 @@ void mzed_trsm_upper_left_newton_john(const mzed_t *U, mzed_t *B) {
   assert(B->nrows == U->ncols);
 
   const gf2e *ff = U->finite_field;
-  if ( (__M4RI_TWOPOW(ff->degree) >= U->nrows) ) {
+  if (_mzed_trsm_newton_john_cutoff(ff) >= U->nrows) {
     mzed_trsm_upper_left_naive(U, B);
     return;
   }
@@ -559,7 +904,7 @@ void mzed_trsm_upper_left_newton_john(const mzed_t *U, mzed_t *B) {
     mzed_rescale_row(B, i, 0, gf2e_inv(ff, mzed_read_elem(U, i, i)));
     mzed_make_table(T0, B, i, 0);
     for(rci_t j=0; j<i; j++)
-      mzd_combine(B->x, j, 0, B->x, j, 0, T0->T->x, T0->L[mzed_read_elem(U, j, i)], 0);
+      njt_mzed_addmul_row(B, j, T0, mzed_read_elem(U, j, i));
   }
   njt_mzed_free(T0);
 }
@@ -570,7 +915,7 @@ void mzd_slice_trsm_lower_left_newton_john(const mzd_slice_t *L, mzd_slice_t *B)
   assert(B->nrows == L->ncols);
 
   const gf2e *ff = L->finite_field;
-  if (__M4RI_TWOPOW(ff->degree) >= L->nrows) {
+  if (_mzed_trsm_newton_john_cutoff(ff) >= L->nrows) {
     mzd_slice_trsm_lower_left_naive(L, B);
     return;
   }
@@ -582,7 +927,7 @@ void mzd_slice_trsm_lower_left_newton_john(const mzd_slice_t *L, mzd_slice_t *B)
     mzed_rescale_row(Be, i, 0, gf2e_inv(ff, mzd_slice_read_elem(L, i, i)));
     mzed_make_table(T0, Be, i, 0);
     for(rci_t j=i+1; j<Be->nrows; j++)
-      mzd_combine(Be->x, j, 0, Be->x, j, 0, T0->T->x, T0->L[mzd_slice_read_elem(L, j, i)], 0);
+      njt_mzed_addmul_row(Be, j, T0, mzd_slice_read_elem(L, j, i));
   }
   mzed_slice(B, Be);
   mzed_free(Be);
@@ -595,7 +940,7 @@ void mzd_slice_trsm_upper_left_newton_john(const mzd_slice_t *U, mzd_slice_t *B)
   assert(B->nrows == U->ncols);
 
   const gf2e *ff = U->finite_field;
-  if ( (__M4RI_TWOPOW(ff->degree) >= U->nrows)) {
+  if (_mzed_trsm_newton_john_cutoff(ff) >= U->nrows) {
     mzd_slice_trsm_upper_left_naive(U, B);
     return;
   }
@@ -607,7 +952,7 @@ void mzd_slice_trsm_upper_left_newton_john(const mzd_slice_t *U, mzd_slice_t *B)
     mzed_rescale_row(Be, i, 0, gf2e_inv(ff, mzd_slice_read_elem(U, i, i)));
     mzed_make_table(T0, Be, i, 0);
     for(rci_t j=0; j<i; j++)
-      mzd_combine(Be->x, j, 0, Be->x, j, 0, T0->T->x, T0->L[mzd_slice_read_elem(U, j, i)], 0);
+      njt_mzed_addmul_row(Be, j, T0, mzd_slice_read_elem(U, j, i));
   }
   mzed_slice(B, Be);
   mzed_free(Be);
@@ -34,6 +34,55 @@
 #include <m4rie/mzed.h>
 #include <m4rie/mzd_slice.h>
 
+/**
+ * \brief Smallest width in words of the strips of columns _mzed_mul_newton_john() builds tables for.
+ *
+ * Narrower strips make the bookkeeping per row of a table and per row of C dominate.
+ */
+
+#define __M4RIE_NJT_MIN_STRIP 32
+
+/**
+ * \brief Maximal number of released Newton-John tables every thread keeps for reuse in a free list
+ * of its own.
+ *
+ * Every thread of a parallel multiplication holds up to eight tables at a time.
+ */
+
+#define __M4RIE_NJT_LOCAL_SIZE 8
+
+/**
+ * \brief Maximal number of bytes of released Newton-John tables every thread keeps in a free list
+ * of its own.
+ */
+
+#define __M4RIE_NJT_LOCAL_BYTES (1<<22)
+
+/**
+ * \brief Maximal number of released Newton-John tables kept for reuse in the overflow shared by
+ * all threads.
+ */
+
+#define __M4RIE_NJT_POOL_SIZE 64
+
+/**
+ * \brief Maximal number of bytes of released Newton-John tables kept for reuse in the overflow
+ * shared by all threads.
+ */
+
+#define __M4RIE_NJT_POOL_BYTES (1<<25)
+
+/**
+ * \brief Newton-John tables over fields of larger degree are split.
+ *
+ * A split table consists of one table for the multiples by the lower __M4RIE_NJT_SPLIT bits of a
+ * scalar and one for the multiples by its upper bits, a multiple is the sum of one row of each.
+ * This takes \f$2^8 + 2^{e-8}\f$ instead of \f$2^e\f$ rows. Entries of such fields are 16 bits
+ * wide, so the two halves are what mzd_process_rows2() and friends read for one entry.
+ */
+
+#define __M4RIE_NJT_SPLIT 8
+
 /**
  * \brief Newton-John table
  */
@@ -41,12 +90,31 @@
 typedef struct {
   rci_t *L;  /**< A map such that L[a] points to the row where the first entry is a. */
   mzed_t *M; /**< Table of length \e with multiples of the input s.t. \f$a^i\f$ is the first entry of row \f$i\f$. */
-  mzed_t *T; /**< Actual table of length \f$2^e\f$ of all linear combinations of T. */
+  mzed_t *T; /**< Actual table of length \f$2^e\f$ of all linear combinations of M. If split, only
+                  of its first __M4RIE_NJT_SPLIT rows, and L is indexed by the lower bits of a. */
+  rci_t *L1; /**< NULL or, if split, L1[a] points to the row of T1 where the first entry is \f$a \cdot x^8\f$. */
+  mzed_t *T1; /**< NULL or, if split, table of all linear combinations of the remaining rows of M. */
+  wi_t zero; /**< Number of leading words of all rows of T and T1 which are known to be zero. */
 } njt_mzed_t;
 
+/**
+ * \brief Return the number of rows of all parts of a Newton-John table over ff.
+ *
+ * \param ff Finite field.
+ */
+
+static inline rci_t njt_mzed_rows(const gf2e *ff) {
+  if (ff->degree > __M4RIE_NJT_SPLIT)
+    return __M4RI_TWOPOW(__M4RIE_NJT_SPLIT) + __M4RI_TWOPOW(ff->degree - __M4RIE_NJT_SPLIT);
+  return __M4RI_TWOPOW(ff->degree);
+}
+
 /**
  * \brief Allocate Newton-John table of dimension gf2e::degree<<1 * ncols.
  *
+ * The table is split if gf2e::degree > __M4RIE_NJT_SPLIT. Its contents are undefined, it may be
+ * a table released by njt_mzed_free() before.
+ *
  * \param ff Finite field.
  * \param ncols Integer > 0.
  */
@@ -56,11 +124,38 @@ njt_mzed_t *njt_mzed_init(const gf2e *ff, const rci_t ncols);
 /**
  * \brief Free Newton-John table
  *
+ * The table is kept in a free list of the calling thread or, if that is full, in an overflow
+ * shared by all threads, and returned by a later njt_mzed_init() for a field of the same degree and
+ * the same number of columns. The tables released longest ago are moved from the free list to the
+ * overflow and from the overflow back to the system first, see __M4RIE_NJT_LOCAL_SIZE,
+ * __M4RIE_NJT_LOCAL_BYTES, __M4RIE_NJT_POOL_SIZE and __M4RIE_NJT_POOL_BYTES.
+ *
  * \param t Table
+ *
+ * \sa njt_mzed_pool_clear()
  */
 
 void njt_mzed_free(njt_mzed_t *t);
 
+/**
+ * \brief Free all Newton-John tables kept for reuse.
+ *
+ * This frees the shared overflow, the free list of the calling thread and those of the threads of
+ * an OpenMP team of m4rie_get_num_threads() threads. It may be called while other threads use
+ * M4RIE, tables in use are not affected.
+ *
+ * \sa njt_mzed_free()
+ */
+
+void njt_mzed_pool_clear(void);
+
+/**
+ * \brief Return the number of bytes of the Newton-John tables kept for reuse by the calling
+ * thread and in the shared overflow.
+ */
+
+size_t njt_mzed_pool_size(void);
+
 /**
  * \brief Construct Newton-John table T for row r of A, and element A[r,c].
  *
@@ -72,6 +167,26 @@ void njt_mzed_free(njt_mzed_t *t);
 
 njt_mzed_t * mzed_make_table(njt_mzed_t *T, const mzed_t *A, const rci_t r, const rci_t c);
 
+/**
+ * \brief C[rc] = C[rc] + a*A[r] where T is the Newton-John table for row r of A and element
+ * A[r,0].
+ *
+ * \param C Matrix with as many columns as A.
+ * \param rc Row index.
+ * \param T Newton-John table.
+ * \param a Finite field element.
+ */
+
+static inline void njt_mzed_addmul_row(mzed_t *C, const rci_t rc, const njt_mzed_t *T, const word a) {
+  if (T->T1 == NULL) {
+    mzd_combine(C->x, rc, 0, C->x, rc, 0, T->T->x, T->L[a], 0);
+  } else {
+    word const *t[2] = {T->T->x->rows[T->L[a & __M4RI_LEFT_BITMASK(__M4RIE_NJT_SPLIT)]],
+                        T->T1->x->rows[T->L1[a >> __M4RIE_NJT_SPLIT]]};
+    _mzd_combine_2(C->x->rows[rc], t, C->x->width);
+  }
+}
+
 /**
  * \brief \f$C = A \cdot B\f$ using Newton-John tables.
  *
@@ -120,7 +235,9 @@ mzed_t *_mzed_mul_newton_john0(mzed_t *C, const mzed_t *A, const mzed_t *B);
 /**
  * \brief \f$C = C + A \cdot B\f$ using Newton-John tables.
  *
- * This is an optimised implementation.
+ * This is an optimised implementation. B is processed in strips of columns such that the up to
+ * eight tables built at once for a strip fit into the L2 cache. For large degrees fewer tables
+ * are built at once. If several threads are used, they split the strips between them.
  *
  * \param C Preallocated product matrix.
  * \param A Input matrix A.
@@ -133,6 +250,20 @@ mzed_t *_mzed_mul_newton_john0(mzed_t *C, const mzed_t *A, const mzed_t *B);
 
 mzed_t *_mzed_mul_newton_john(mzed_t *C, const mzed_t *A, const mzed_t *B);
 
+/**
+ * \brief \f$C = C + A \cdot B\f$ using Newton-John tables built beforehand.
+ *
+ * \param C Preallocated product matrix.
+ * \param A Input matrix A.
+ * \param T Tables of all rows of B, T[i] as returned by mzed_make_table(T[i], B, i, 0).
+ *
+ * \sa mzed_prepared_init()
+ *
+ * \ingroup Multiplication
+ */
+
+mzed_t *_mzed_mul_newton_john_prepared(mzed_t *C, const mzed_t *A, njt_mzed_t *const *T);
+
 /**
  * \brief Reduce matrix A to row echelon form using Gauss-Newton-John
  * elimination.
@@ -203,6 +334,11 @@ void mzd_slice_trsm_upper_left_newton_john(const mzd_slice_t *U, mzd_slice_t *B)
 /**
  * \brief PLE decomposition: \f$L \cdot E = P\cdot A\f$ using Newton-John tables.
  *
+ * Pivots are chosen as in mzed_ple_naive() and the result is the same. Up to six pivots are
+ * searched for in a few words of columns at a time, only these columns are eliminated for every
+ * pivot. The remaining columns of all rows below are updated once per batch of pivots with one
+ * Newton-John table per pivot, cf. mzed_echelonize_newton_john().
+ *
  * \ingroup PLE
  */
 
@@ -225,7 +361,10 @@ rci_t mzed_ple_newton_john(mzed_t *A, mzp_t *P, mzp_t *Q);
  */
 
 static inline void mzed_process_rows(mzed_t *M, const rci_t startrow, const rci_t endrow, rci_t startcol, const njt_mzed_t *T) {
-  mzd_process_rows(M->x, startrow, endrow, startcol*M->w, M->w, T->T->x, T->L);
+  if (T->T1)
+    mzd_process_rows2(M->x, startrow, endrow, startcol*M->w, M->w, T->T->x, T->L, T->T1->x, T->L1);
+  else
+    mzd_process_rows(M->x, startrow, endrow, startcol*M->w, M->w, T->T->x, T->L);
 }
 
 /**
@@ -244,7 +383,11 @@ static inline void mzed_process_rows(mzed_t *M, const rci_t startrow, const rci_
 
 static inline void mzed_process_rows2(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol, 
                                       const njt_mzed_t *T0, const njt_mzed_t *T1) {
-  mzd_process_rows2(M->x, startrow, endrow, startcol*M->w, 2*M->w, T0->T->x, T0->L, T1->T->x, T1->L);
+  if (T0->T1)
+    mzd_process_rows4(M->x, startrow, endrow, startcol*M->w, 2*M->w, T0->T->x, T0->L, T0->T1->x, T0->L1,
+                      T1->T->x, T1->L, T1->T1->x, T1->L1);
+  else
+    mzd_process_rows2(M->x, startrow, endrow, startcol*M->w, 2*M->w, T0->T->x, T0->L, T1->T->x, T1->L);
 }
 
 /**
@@ -264,7 +407,11 @@ static inline void mzed_process_rows2(mzed_t *M, const rci_t startrow, const rci
 
 static inline void mzed_process_rows3(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol,
                                       const njt_mzed_t *T0, const njt_mzed_t *T1, const njt_mzed_t *T2) {
-  mzd_process_rows3(M->x, startrow, endrow, startcol*M->w, 3*M->w, T0->T->x, T0->L, T1->T->x, T1->L, T2->T->x, T2->L);
+  if (T0->T1)
+    mzd_process_rows6(M->x, startrow, endrow, startcol*M->w, 3*M->w, T0->T->x, T0->L, T0->T1->x, T0->L1,
+                      T1->T->x, T1->L, T1->T1->x, T1->L1, T2->T->x, T2->L, T2->T1->x, T2->L1);
+  else
+    mzd_process_rows3(M->x, startrow, endrow, startcol*M->w, 3*M->w, T0->T->x, T0->L, T1->T->x, T1->L, T2->T->x, T2->L);
 }
 
 /**
@@ -280,11 +427,20 @@ static inline void mzed_process_rows3(mzed_t *M, const rci_t startrow, const rci
  * \param T2 Newton-John table
  * \param T3 Newton-John table
  *
+ * Split tables, see __M4RIE_NJT_SPLIT, are processed in two passes over the rows. This gives the
+ * same result if every table is zero in the columns read for the other tables, as is the case
+ * for tables of reduced pivot rows.
+ *
  * \ingroup RowOperations
  */
 
 static inline void mzed_process_rows4(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol,
                                       const njt_mzed_t *T0, const njt_mzed_t *T1, const njt_mzed_t *T2, const njt_mzed_t *T3) {
+  if (T0->T1) {
+    mzed_process_rows2(M, startrow, endrow, startcol,   T0, T1);
+    mzed_process_rows2(M, startrow, endrow, startcol+2, T2, T3);
+    return;
+  }
   mzd_process_rows4(M->x, startrow, endrow, startcol*M->w, 4*M->w, T0->T->x, T0->L, T1->T->x, T1->L, T2->T->x, T2->L, T3->T->x, T3->L);
 }
 
@@ -302,11 +458,20 @@ static inline void mzed_process_rows4(mzed_t *M, const rci_t startrow, const rci
  * \param T3 Newton-John table
  * \param T4 Newton-John table
  *
+ * Split tables, see __M4RIE_NJT_SPLIT, are processed in two passes over the rows. This gives the
+ * same result if every table is zero in the columns read for the other tables, as is the case
+ * for tables of reduced pivot rows.
+ *
  * \ingroup RowOperations
  */
 
 static inline void mzed_process_rows5(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol,
                                       const njt_mzed_t *T0, const njt_mzed_t *T1, const njt_mzed_t *T2, const njt_mzed_t *T3, const njt_mzed_t *T4) {
+  if (T0->T1) {
+    mzed_process_rows3(M, startrow, endrow, startcol,   T0, T1, T2);
+    mzed_process_rows2(M, startrow, endrow, startcol+3, T3, T4);
+    return;
+  }
   mzd_process_rows5(M->x, startrow, endrow, startcol*M->w, 5*M->w, T0->T->x, T0->L, T1->T->x, T1->L, T2->T->x, T2->L, T3->T->x, T3->L, T4->T->x, T4->L);
 }
 
@@ -326,12 +491,21 @@ static inline void mzed_process_rows5(mzed_t *M, const rci_t startrow, const rci
  * \param T4 Newton-John table
  * \param T5 Newton-John table
  *
+ * Split tables, see __M4RIE_NJT_SPLIT, are processed in two passes over the rows. This gives the
+ * same result if every table is zero in the columns read for the other tables, as is the case
+ * for tables of reduced pivot rows.
+ *
  * \ingroup RowOperations
  */
 
 static inline void mzed_process_rows6(mzed_t *M, const rci_t startrow, const rci_t endrow, const rci_t startcol,
                                       const njt_mzed_t *T0, const njt_mzed_t *T1, const njt_mzed_t *T2,
                                       const njt_mzed_t *T3, const njt_mzed_t *T4, const njt_mzed_t *T5) {
+  if (T0->T1) {
+    mzed_process_rows3(M, startrow, endrow, startcol,   T0, T1, T2);
+    mzed_process_rows3(M, startrow, endrow, startcol+3, T3, T4, T5);
+    return;
+  }
   mzd_process_rows6(M->x, startrow, endrow, startcol*M->w, 6*M->w, T0->T->x, T0->L, T1->T->x, T1->L, T2->T->x, T2->L, T3->T->x, T3->L, T4->T->x, T4->L, T5->T->x, T5->L);
 }
 
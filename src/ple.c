@@ -28,24 +28,15 @@ rci_t mzed_ple_naive(mzed_t *A, mzp_t *P, mzp_t *Q) {
   word tmp = 0;
   const gf2e *ff = A->finite_field;
   rci_t i,j;
-  int found = 0;
+  rci_t *first = (rci_t*)m4ri_mm_calloc(A->nrows, sizeof(rci_t));
 
   while (row_pos < A->nrows && col_pos < A->ncols) {
-    found = 0;
-    for(j=col_pos; j<A->ncols; j++) {
-      for(i=row_pos; i<A->nrows; i++) {
-        if( (tmp = mzed_read_elem(A, i,j)) != 0) {
-          found = 1;
-          break;
-        }
-      }
-      if (found)
-        break;
-    }
-    if (found) {
+    if (mzed_find_pivot(A, row_pos, col_pos, A->ncols, first, &i, &j)) {
+      tmp = mzed_read_elem(A, i, j);
       P->values[row_pos] = i;
       Q->values[row_pos] = j;
       mzed_row_swap(A, row_pos, i);
+      first[i] = first[row_pos]; /* row_pos is not searched again */
 
       if(j+1 < A->ncols) {
         mzed_rescale_row(A, row_pos, j+1, gf2e_inv(ff, tmp));
@@ -68,18 +59,19 @@ rci_t mzed_ple_naive(mzed_t *A, mzp_t *P, mzp_t *Q) {
   for (rci_t i=0; i < row_pos; i++) {
     mzed_col_swap_in_rows(A, i, Q->values[i], i, A->nrows);
   }
+  m4ri_mm_free(first);
   return row_pos;
 }
 
 rci_t _mzed_ple(mzed_t *A, mzp_t *P, mzp_t *Q, rci_t cutoff) {
   if (cutoff == 0)
-    cutoff = __M4RIE_PLE_CUTOFF;
+    cutoff = m4rie_profile_get()->ple;
 
   if ((A->ncols > m4ri_radix && (gf2e_degree_to_w(A->finite_field) * A->ncols * A->nrows) > cutoff)) {
-    mzd_slice_t *a = mzed_slice(NULL, A);
+    mzd_slice_t *a = mzed_slice(_mzd_slice_init_scratch(A->finite_field, A->nrows, A->ncols), A);
     rci_t r = _mzd_slice_ple(a, P, Q, cutoff);
     mzed_cling(A, a);
-    mzd_slice_free(a);
+    _mzd_slice_free_scratch(a);
     return r;
   } else {
     return mzed_ple_newton_john(A, P, Q);
@@ -91,13 +83,13 @@ rci_t _mzd_slice_ple(mzd_slice_t *A, mzp_t *P, mzp_t *Q, rci_t cutoff) {
   const rci_t nrows = A->nrows;
 
   if (cutoff == 0)
-    cutoff = __M4RIE_PLE_CUTOFF;
+    cutoff = m4rie_profile_get()->ple;
 
   if (ncols <= m4ri_radix || (gf2e_degree_to_w(A->finite_field) * A->ncols * A->nrows) <= cutoff) {
-    mzed_t *Abar = mzed_cling(NULL, A);
+    mzed_t *Abar = mzed_cling(_mzed_init_scratch(A->finite_field, A->nrows, A->ncols), A);
     rci_t r = mzed_ple_newton_john(Abar, P, Q);
     mzed_slice(A, Abar);
-    mzed_free(Abar);
+    _mzed_free_scratch(Abar);
     return r;
   }
 
@@ -163,7 +163,7 @@ static inline rci_t mzd_slice_pluq(mzd_slice_t *A, mzp_t *P, mzp_t *Q) {
  * \param A Matrix
  * \param P Permutation vector of length A->nrows
  * \param Q Permutation vector of length A->ncols
- * \param cutoff Integer >= 0
+ * \param cutoff Integer >= 0, 0 for the cutoff of the profile in use (see m4rie_profile_get())
  *
  * \ingroup PLE
  *
@@ -173,7 +173,7 @@ static inline rci_t mzd_slice_pluq(mzd_slice_t *A, mzp_t *P, mzp_t *Q) {
 rci_t _mzed_ple(mzed_t *A, mzp_t *P, mzp_t *Q, rci_t cutoff);
 
 /**
- * Default crossover to PLE base case (Newton-John based).
+ * Default crossover to PLE base case (Newton-John based), see m4rie_profile_t.
  */
 
 #define __M4RIE_PLE_CUTOFF (__M4RI_CPU_L2_CACHE<<2)
@@ -201,7 +201,7 @@ rci_t _mzed_ple(mzed_t *A, mzp_t *P, mzp_t *Q, rci_t cutoff);
  */
 
 static inline rci_t mzed_ple(mzed_t *A, mzp_t *P, mzp_t *Q) {
-  return _mzed_ple(A, P, Q, __M4RIE_PLE_CUTOFF);
+  return _mzed_ple(A, P, Q, 0);
 }
 
 #endif //M4RIE_PLE_H
@@ -0,0 +1,152 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include "config.h"
+
+#include <ctype.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "profile.h"
+#include "ple.h"
+#include "trsm.h"
+#include "blm.h"
+
+static m4rie_profile_t m4rie_profile;
+static volatile int m4rie_profile_ready = 0;
+
+void m4rie_profile_defaults(m4rie_profile_t *p) {
+  for(int e=0; e<=M4RIE_MAX_DEGREE; e++) {
+    p->karatsuba[e] = 512;
+    p->blm[e] = 0;
+    p->strassen[e] = 0;
+    p->trsm_newton_john[e] = 0;
+  }
+  p->ple = __M4RIE_PLE_CUTOFF;
+  p->echelonize = 2*__M4RIE_PLE_CUTOFF;
+  p->trsm = MZED_TRSM_CUTOFF;
+  p->blm_stream = __M4RIE_BLM_STREAM_CUTOFF;
+}
+
+/**
+ * Read entries from filename into p, entries not in the file are left alone.
+ */
+
+static int _m4rie_profile_read(m4rie_profile_t *p, const char *filename) {
+  FILE *fh = fopen(filename, "r");
+  if (fh == NULL)
+    return -1;
+
+  int ret = 0;
+  char line[256];
+  while (ret == 0 && fgets(line, sizeof(line), fh) != NULL) {
+    const char *s = line;
+    while (isspace((unsigned char)*s))
+      s++;
+    if (*s == '\0' || *s == '#')
+      continue;
+
+    char key[32];
+    long a = 0, b = 0;
+    const int c = sscanf(s, "%31s %ld %ld", key, &a, &b);
+
+    rci_t *table = NULL;
+    rci_t *entry = NULL;
+    size_t *bytes = NULL;
+    if (strcmp(key, "karatsuba") == 0)
+      table = p->karatsuba;
+    else if (strcmp(key, "blm") == 0)
+      table = p->blm;
+    else if (strcmp(key, "strassen") == 0)
+      table = p->strassen;
+    else if (strcmp(key, "ple") == 0)
+      entry = &p->ple;
+    else if (strcmp(key, "echelonize") == 0)
+      entry = &p->echelonize;
+    else if (strcmp(key, "trsm") == 0)
+      entry = &p->trsm;
+    else if (strcmp(key, "trsm_newton_john") == 0)
+      table = p->trsm_newton_john;
+    else if (strcmp(key, "blm_stream") == 0)
+      bytes = &p->blm_stream;
+
+    if (table != NULL && c == 3 && a >= 2 && a <= M4RIE_MAX_DEGREE && b >= 0 && b <= INT_MAX)
+      table[a] = (rci_t)b;
+    else if (entry != NULL && c == 2 && a >= 0 && a <= INT_MAX)
+      *entry = (rci_t)a;
+    else if (bytes != NULL && c == 2 && a >= 0)
+      *bytes = (size_t)a;
+    else
+      ret = -1;
+  }
+  fclose(fh);
+  return ret;
+}
+
+const m4rie_profile_t *m4rie_profile_get(void) {
+  if (!m4rie_profile_ready) {
+#ifdef HAVE_OPENMP
+#pragma omp critical (m4rie_profile)
+#endif
+    {
+      if (!m4rie_profile_ready) {
+        m4rie_profile_defaults(&m4rie_profile);
+        const char *env = getenv("M4RIE_PROFILE");
+        if (env != NULL && *env != '\0' && _m4rie_profile_read(&m4rie_profile, env) != 0)
+          m4ri_die("M4RIE_PROFILE: cannot read profile '%s'.\n", env);
+        m4rie_profile_ready = 1;
+      }
+    }
+  }
+  return &m4rie_profile;
+}
+
+void m4rie_profile_set(const m4rie_profile_t *p) {
+  if (p == NULL)
+    m4rie_profile_defaults(&m4rie_profile);
+  else
+    m4rie_profile = *p;
+  m4rie_profile_ready = 1;
+}
+
+int m4rie_profile_load(const char *filename) {
+  m4rie_profile_t p;
+  m4rie_profile_defaults(&p);
+  if (_m4rie_profile_read(&p, filename) != 0)
+    return -1;
+  m4rie_profile_set(&p);
+  return 0;
+}
+
+void m4rie_profile_write(const m4rie_profile_t *p, FILE *fh) {
+  fprintf(fh, "# M4RIE crossover profile, see m4rie/profile.h\n");
+  for(int e=2; e<=M4RIE_MAX_DEGREE; e++)
+    fprintf(fh, "karatsuba %2d %d\n", e, p->karatsuba[e]);
+  for(int e=2; e<=M4RIE_MAX_DEGREE; e++)
+    fprintf(fh, "blm %2d %d\n", e, p->blm[e]);
+  for(int e=2; e<=M4RIE_MAX_DEGREE; e++)
+    fprintf(fh, "strassen %2d %d\n", e, p->strassen[e]);
+  fprintf(fh, "ple %d\n", p->ple);
+  fprintf(fh, "echelonize %d\n", p->echelonize);
+  fprintf(fh, "trsm %d\n", p->trsm);
+  for(int e=2; e<=M4RIE_MAX_DEGREE; e++)
+    fprintf(fh, "trsm_newton_john %2d %d\n", e, p->trsm_newton_john[e]);
+  fprintf(fh, "blm_stream %lu\n", (unsigned long)p->blm_stream);
+}
@@ -0,0 +1,152 @@
+/**
+ * \file profile.h
+ * \brief Machine specific crossover points between algorithms.
+ *
+ * Functions which do not specify an algorithm, such as mzed_mul(), mzed_ple(), mzed_echelonize()
+ * or mzed_trsm_upper_left(), choose one based on the dimensions of their input. The dimensions at
+ * which one algorithm becomes faster than another depend on the machine. They are collected in a
+ * profile which the program m4rie-tune measures and writes to a file.
+ *
+ * The profile in use is loaded from the file named by the environment variable M4RIE_PROFILE
+ * when it is first needed, or set with m4rie_profile_set() or m4rie_profile_load(). Entries which
+ * are missing from the file keep their built-in defaults.
+ *
+ * The file consists of lines "key value" or "key degree value", lines starting with '#' are
+ * ignored:
+ *
+ * \verbatim
+ karatsuba <e> <n>   mzed_mul() uses Karatsuba if all dimensions are >= n
+ blm <e> <n>         mzd_slice_mul() uses bilinear maps if all dimensions are >= n (0: never)
+ strassen <e> <n>    crossover dimension of Strassen-Winograd to Newton-John (0: heuristic)
+ ple <n>             PLE switches to Newton-John if e*nrows*ncols <= n
+ echelonize <n>      mzed_echelonize() uses Newton-John if e*nrows*ncols <= n
+ trsm <n>            crossover dimension of TRSM to Newton-John
+ trsm_newton_john <e> <n>  Newton-John TRSM falls back to naive up to n rows (0: heuristic)
+ blm_stream <n>      bilinear maps stream their products if the temporaries exceed n bytes
+ \endverbatim
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_PROFILE_H
+#define M4RIE_PROFILE_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <stdio.h>
+#include <m4ri/m4ri.h>
+#include <m4rie/gf2e.h>
+
+/**
+ * \brief Crossover points between algorithms.
+ *
+ * Arrays are indexed by the degree of the field.
+ */
+
+typedef struct {
+  rci_t karatsuba[M4RIE_MAX_DEGREE+1]; /**< Karatsuba instead of Strassen-Winograd if m, l, n >= this. */
+  rci_t blm[M4RIE_MAX_DEGREE+1];       /**< Bilinear maps instead of Karatsuba if m, l, n >= this, 0 for never. */
+  rci_t strassen[M4RIE_MAX_DEGREE+1];  /**< Cutoff of Strassen-Winograd, 0 for the heuristic in _mzed_strassen_cutoff(). */
+  rci_t ple;                           /**< Cutoff of asymptotically fast PLE in bits, see _mzed_ple(). */
+  rci_t echelonize;                    /**< Newton-John echelon form up to this many bits, see mzed_echelonize(). */
+  rci_t trsm;                          /**< Cutoff of asymptotically fast TRSM. */
+  rci_t trsm_newton_john[M4RIE_MAX_DEGREE+1]; /**< Naive instead of Newton-John TRSM up to this many rows, 0 for the number of rows of a table. */
+  size_t blm_stream;                   /**< Temporary memory in bytes before bilinear maps stream their products, see _mzd_ptr_apply_blm_djb(). */
+} m4rie_profile_t;
+
+/**
+ * \brief Set all entries of p to the built-in defaults.
+ *
+ * \param p Profile.
+ */
+
+void m4rie_profile_defaults(m4rie_profile_t *p);
+
+/**
+ * \brief Return the profile in use.
+ *
+ * On first call the file named by the environment variable M4RIE_PROFILE is loaded if it is set,
+ * the built-in defaults are used otherwise.
+ */
+
+const m4rie_profile_t *m4rie_profile_get(void);
+
+/**
+ * \brief Use p from now on.
+ *
+ * \param p Profile, copied, or NULL to restore the built-in defaults.
+ *
+ * \note This setting is process-wide and should be changed outside of parallel regions.
+ */
+
+void m4rie_profile_set(const m4rie_profile_t *p);
+
+/**
+ * \brief Read a profile from a file and use it from now on.
+ *
+ * Entries missing from the file are set to the built-in defaults.
+ *
+ * \param filename File written by m4rie_profile_write() or m4rie-tune.
+ *
+ * \return 0 on success, -1 if the file cannot be read or is malformed, in which case the profile
+ * in use is not changed.
+ */
+
+int m4rie_profile_load(const char *filename);
+
+/**
+ * \brief Write p in the format read by m4rie_profile_load().
+ *
+ * \param p Profile.
+ * \param fh Open file.
+ */
+
+void m4rie_profile_write(const m4rie_profile_t *p, FILE *fh);
+
+/**
+ * \brief Return true if Karatsuba should be used to multiply an m x l by an l x n matrix over ff.
+ *
+ * \param ff Finite field.
+ * \param m Number of rows of the left operand.
+ * \param l Number of columns of the left operand.
+ * \param n Number of columns of the right operand.
+ */
+
+static inline int m4rie_profile_use_karatsuba(const gf2e *ff, rci_t m, rci_t l, rci_t n) {
+  const rci_t c = m4rie_profile_get()->karatsuba[ff->degree];
+  return (m >= c && l >= c && n >= c);
+}
+
+/**
+ * \brief Return true if bilinear maps should be used instead of Karatsuba to multiply an m x l by
+ * an l x n bitsliced matrix over ff.
+ *
+ * \param ff Finite field.
+ * \param m Number of rows of the left operand.
+ * \param l Number of columns of the left operand.
+ * \param n Number of columns of the right operand.
+ */
+
+static inline int m4rie_profile_use_blm(const gf2e *ff, rci_t m, rci_t l, rci_t n) {
+  const rci_t c = m4rie_profile_get()->blm[ff->degree];
+  return (c > 0 && m >= c && l >= c && n >= c);
+}
+
+#endif //M4RIE_PROFILE_H
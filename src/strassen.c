@@ -19,17 +19,26 @@
 
 #include "config.h"
 
+#ifdef HAVE_OPENMP
+#include <omp.h>
+#endif
+
 #include <m4ri/misc.h>
 #include <m4ri/mzd.h>
 #include <m4ri/m4ri_config.h>
 
 #include "mzed.h"
+#include "profile.h"
 #include "newton_john.h"
 #include "mzd_slice.h"
 #include "strassen.h"
+#include "threads.h"
+#include "workspace.h"
 
 #define CLOSER(a,b,target) (abs((long)a-(long)target)<abs((long)b-(long)target))
 
+static mzed_t *_mzed_strassen_parallel(mzed_t *C, const mzed_t *A, const mzed_t *B, int cutoff, const int addmul);
+
 mzed_t *mzed_mul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int cutoff) {
   C = _mzed_mul_init(C, A, B, TRUE);
   return _mzed_mul_strassen(C, A, B, cutoff);
@@ -54,14 +63,17 @@ mzed_t *_mzed_mul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int cuto
        overhead and improves data locality, if you remove it make sure
        there are no speed regressions */
     /* C = _mzd_mul_m4rm(C, A, B, 0, TRUE); */
-    mzed_t *Cbar = mzed_init(C->finite_field, C->nrows, C->ncols);
+    mzed_t *Cbar = _mzed_init_scratch(C->finite_field, C->nrows, C->ncols);
     _mzed_mul_newton_john(Cbar, A, B);
 
     mzed_copy(C, Cbar);
-    mzed_free(Cbar);
+    _mzed_free_scratch(Cbar);
     return C;
   }
 
+  if (m4rie_parallel_worthwhile(m, A->x->ncols, B->x->ncols))
+    return _mzed_strassen_parallel(C, A, B, cutoff, FALSE);
+
   rci_t mmm = m/2;
   rci_t kkk = k/2;
   rci_t nnn = n/2;
@@ -96,8 +108,8 @@ mzed_t *_mzed_mul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int cuto
    */
 
   /* change this to mzd_init(mmm, MAX(nnn,kkk)) to fix the todo below */
-  mzed_t *Wmk = mzed_init(A->finite_field, mmm, kkk);
-  mzed_t *Wkn = mzed_init(A->finite_field, kkk, nnn);
+  mzed_t *Wmk = _mzed_init_scratch(A->finite_field, mmm, kkk);
+  mzed_t *Wkn = _mzed_init_scratch(A->finite_field, kkk, nnn);
 
   _mzed_add(Wkn, B22, B12);		 /* Wkn = B22 + B12 */
   _mzed_add(Wmk, A22, A12);		 /* Wmk = A22 + A12 */
@@ -115,15 +127,16 @@ mzed_t *_mzed_mul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int cuto
   _mzed_mul_strassen(C12, Wmk, B12, cutoff);    /* C12 = Wmk * B12 */
   _mzed_add(C12, C12, C22);		 /* C12 = C12 + C22 */
 
-  mzed_free(Wmk);
-  Wmk = mzed_mul_strassen(NULL, A12, B21, cutoff);/*Wmk = A12 * B21 */
+  _mzed_free_scratch(Wmk);
+  Wmk = _mzed_init_scratch(A->finite_field, mmm, nnn);
+  _mzed_mul_strassen(Wmk, A12, B21, cutoff);     /* Wmk = A12 * B21 */
 
   _mzed_add(C11, C11, Wmk);		  /* C11 = C11 + Wmk */
   _mzed_add(C12, C11, C12);		  /* C12 = C11 - C12 */
   _mzed_add(C11, C21, C11);		  /* C11 = C21 - C11 */
   _mzed_add(Wkn, Wkn, B11);		  /* Wkn = Wkn - B11 */
   _mzed_mul_strassen(C21, A21, Wkn, cutoff);     /* C21 = A21 * Wkn */
-  mzed_free(Wkn);
+  _mzed_free_scratch(Wkn);
 
   _mzed_add(C21, C11, C21);		  /* C21 = C11 - C21 */
   _mzed_add(C22, C22, C11);		  /* C22 = C22 + C11 */
@@ -141,7 +154,7 @@ mzed_t *_mzed_mul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int cuto
   mzed_free_window(C11); mzed_free_window(C12);
   mzed_free_window(C21); mzed_free_window(C22);
 
-  mzed_free(Wmk);
+  _mzed_free_scratch(Wmk);
 
   /* deal with rest */
   nnn*=2;
@@ -198,14 +211,18 @@ mzed_t *_mzed_addmul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int c
        overhead and improves data locality, if you remove it make sure
        there are no speed regressions */
     /* C = _mzd_mul_m4rm(C, A, B, 0, TRUE); */
-    mzed_t *Cbar = mzed_copy(NULL, C);
+    mzed_t *Cbar = _mzed_init_scratch(C->finite_field, C->nrows, C->ncols);
+    mzed_copy(Cbar, C);
     _mzed_mul_newton_john(Cbar, A, B);
 
     mzed_copy(C, Cbar);
-    mzed_free(Cbar);
+    _mzed_free_scratch(Cbar);
     return C;
   }
 
+  if (m4rie_parallel_worthwhile(m, A->x->ncols, B->x->ncols))
+    return _mzed_strassen_parallel(C, A, B, cutoff, TRUE);
+
   rci_t mmm = m/2;
   rci_t kkk = k/2;
   rci_t nnn = n/2;
@@ -239,9 +256,9 @@ mzed_t *_mzed_addmul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int c
    * sequence of operations.
    */
 
-  mzed_t *S = mzed_init(A->finite_field, mmm, kkk);
-  mzed_t *T = mzed_init(A->finite_field, kkk, nnn);
-  mzed_t *U = mzed_init(A->finite_field, mmm, nnn);
+  mzed_t *S = _mzed_init_scratch(A->finite_field, mmm, kkk);
+  mzed_t *T = _mzed_init_scratch(A->finite_field, kkk, nnn);
+  mzed_t *U = _mzed_init_scratch(A->finite_field, mmm, nnn);
 
   _mzed_add(S, A22, A21);                   /* 1  S = A22 - A21       */
   _mzed_add(T, B22, B21);                   /* 2  T = B22 - B21       */
@@ -281,9 +298,9 @@ mzed_t *_mzed_addmul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int c
   mzed_free_window(C11); mzed_free_window(C12);
   mzed_free_window(C21); mzed_free_window(C22);
 
-  mzed_free(S);
-  mzed_free(T);
-  mzed_free(U);
+  _mzed_free_scratch(S);
+  _mzed_free_scratch(T);
+  _mzed_free_scratch(U);
 
 
   /* deal with rest */
@@ -325,46 +342,280 @@ mzed_t *_mzed_addmul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int c
   return C;
 }
 
+/**
+ * Compute C = A*B or C += A*B with the seven products of one Strassen-Winograd step running as
+ * OpenMP tasks.
+ *
+ * Unlike the Bodrato schedule above, which reuses two temporaries and thus has to run the products
+ * one after another, every product gets its own operands and its own output matrix. The products
+ * recurse into this function while depth > 1 and into the serial code otherwise. Since all
+ * arithmetic is exact, the result is the same as the one of the serial schedule.
+ *
+ * Must be called from within a parallel region.
+ */
+
+static void _mzed_strassen_tasks(mzed_t *C, const mzed_t *A, const mzed_t *B, int cutoff, const int depth, const int addmul) {
+  const rci_t m = A->nrows;
+  const rci_t k = A->ncols;
+  const rci_t n = B->ncols;
+
+  if (depth == 0 || (C->nrows | C->ncols) == 0 ||
+      CLOSER(m, m/2, cutoff) || CLOSER(k, k/2, cutoff) || CLOSER(n, n/2, cutoff)) {
+    if (addmul)
+      _mzed_addmul_strassen(C, A, B, cutoff);
+    else
+      _mzed_mul_strassen(C, A, B, cutoff);
+    return;
+  }
+
+  rci_t mmm = m/2;
+  rci_t kkk = k/2;
+  rci_t nnn = n/2;
+
+  mmm = (mmm - mmm%(m4ri_radix/A->w));
+  kkk = (kkk - kkk%(m4ri_radix/A->w));
+  nnn = (nnn - nnn%(m4ri_radix/A->w));
+
+  const gf2e *ff = A->finite_field;
+
+  mzed_t *A11 = mzed_init_window(A,   0,   0,   mmm,   kkk);
+  mzed_t *A12 = mzed_init_window(A,   0, kkk,   mmm, 2*kkk);
+  mzed_t *A21 = mzed_init_window(A, mmm,   0, 2*mmm,   kkk);
+  mzed_t *A22 = mzed_init_window(A, mmm, kkk, 2*mmm, 2*kkk);
+
+  mzed_t *B11 = mzed_init_window(B,   0,   0,   kkk,   nnn);
+  mzed_t *B12 = mzed_init_window(B,   0, nnn,   kkk, 2*nnn);
+  mzed_t *B21 = mzed_init_window(B, kkk,   0, 2*kkk,   nnn);
+  mzed_t *B22 = mzed_init_window(B, kkk, nnn, 2*kkk, 2*nnn);
+
+  mzed_t *C11 = mzed_init_window(C,   0,   0,   mmm,   nnn);
+  mzed_t *C12 = mzed_init_window(C,   0, nnn,   mmm, 2*nnn);
+  mzed_t *C21 = mzed_init_window(C, mmm,   0, 2*mmm,   nnn);
+  mzed_t *C22 = mzed_init_window(C, mmm, nnn, 2*mmm, 2*nnn);
+
+  mzed_t *P[7];
+  for(int i=0; i<7; i++)
+    P[i] = _mzed_init_scratch(ff, mmm, nnn);
+
+  /* P1 = A11 * B11 */
+#ifdef HAVE_OPENMP
+#pragma omp task
+#endif
+  _mzed_strassen_tasks(P[0], A11, B11, cutoff, depth-1, FALSE);
+
+  /* P2 = A12 * B21 */
+#ifdef HAVE_OPENMP
+#pragma omp task
+#endif
+  _mzed_strassen_tasks(P[1], A12, B21, cutoff, depth-1, FALSE);
+
+  /* P3 = (A11 + A12 + A21 + A22) * B22 */
+#ifdef HAVE_OPENMP
+#pragma omp task
+#endif
+  {
+    mzed_t *S = _mzed_init_scratch(ff, mmm, kkk);
+    _mzed_add(S, A11, A12);
+    _mzed_add(S, S, A21);
+    _mzed_add(S, S, A22);
+    _mzed_strassen_tasks(P[2], S, B22, cutoff, depth-1, FALSE);
+    _mzed_free_scratch(S);
+  }
+
+  /* P4 = A22 * (B11 + B12 + B21 + B22) */
+#ifdef HAVE_OPENMP
+#pragma omp task
+#endif
+  {
+    mzed_t *T = _mzed_init_scratch(ff, kkk, nnn);
+    _mzed_add(T, B11, B12);
+    _mzed_add(T, T, B21);
+    _mzed_add(T, T, B22);
+    _mzed_strassen_tasks(P[3], A22, T, cutoff, depth-1, FALSE);
+    _mzed_free_scratch(T);
+  }
+
+  /* P5 = (A21 + A22) * (B11 + B12) */
+#ifdef HAVE_OPENMP
+#pragma omp task
+#endif
+  {
+    mzed_t *S = _mzed_init_scratch(ff, mmm, kkk);
+    mzed_t *T = _mzed_init_scratch(ff, kkk, nnn);
+    _mzed_add(S, A21, A22);
+    _mzed_add(T, B11, B12);
+    _mzed_strassen_tasks(P[4], S, T, cutoff, depth-1, FALSE);
+    _mzed_free_scratch(S);
+    _mzed_free_scratch(T);
+  }
+
+  /* P6 = (A11 + A21 + A22) * (B11 + B12 + B22) */
+#ifdef HAVE_OPENMP
+#pragma omp task
+#endif
+  {
+    mzed_t *S = _mzed_init_scratch(ff, mmm, kkk);
+    mzed_t *T = _mzed_init_scratch(ff, kkk, nnn);
+    _mzed_add(S, A21, A22);
+    _mzed_add(S, S, A11);
+    _mzed_add(T, B11, B12);
+    _mzed_add(T, T, B22);
+    _mzed_strassen_tasks(P[5], S, T, cutoff, depth-1, FALSE);
+    _mzed_free_scratch(S);
+    _mzed_free_scratch(T);
+  }
+
+  /* P7 = (A11 + A21) * (B12 + B22) */
+#ifdef HAVE_OPENMP
+#pragma omp task
+#endif
+  {
+    mzed_t *S = _mzed_init_scratch(ff, mmm, kkk);
+    mzed_t *T = _mzed_init_scratch(ff, kkk, nnn);
+    _mzed_add(S, A11, A21);
+    _mzed_add(T, B12, B22);
+    _mzed_strassen_tasks(P[6], S, T, cutoff, depth-1, FALSE);
+    _mzed_free_scratch(S);
+    _mzed_free_scratch(T);
+  }
+
+  /* the last columns and rows of C do not overlap with the quadrants */
+  if (n > 2*nnn) {
+#ifdef HAVE_OPENMP
+#pragma omp task
+#endif
+    {
+      mzed_t *B_last_col = mzed_init_window(B, 0, 2*nnn, k, n);
+      mzed_t *C_last_col = mzed_init_window(C, 0, 2*nnn, m, n);
+      if (!addmul)
+        mzed_set_ui(C_last_col, 0);
+      _mzed_mul_newton_john(C_last_col, A, B_last_col);
+      mzed_free_window(B_last_col);
+      mzed_free_window(C_last_col);
+    }
+  }
+  if (m > 2*mmm) {
+#ifdef HAVE_OPENMP
+#pragma omp task
+#endif
+    {
+      mzed_t *A_last_row = mzed_init_window(A, 2*mmm, 0, m, k);
+      mzed_t *B_first_col= mzed_init_window(B,     0, 0, k, 2*nnn);
+      mzed_t *C_last_row = mzed_init_window(C, 2*mmm, 0, m, 2*nnn);
+      if (!addmul)
+        mzed_set_ui(C_last_row, 0);
+      _mzed_mul_newton_john(C_last_row, A_last_row, B_first_col);
+      mzed_free_window(A_last_row);
+      mzed_free_window(B_first_col);
+      mzed_free_window(C_last_row);
+    }
+  }
+
+#ifdef HAVE_OPENMP
+#pragma omp taskwait
+#endif
+
+  /* U2 = P1 + P6, U3 = U2 + P7, U4 = U2 + P5 */
+  _mzed_add(P[5], P[5], P[0]);
+  _mzed_add(P[6], P[6], P[5]);
+  _mzed_add(P[5], P[5], P[4]);
+
+  if (addmul) {
+    _mzed_add(C11, C11, P[0]); _mzed_add(C11, C11, P[1]); /* C11 += P1 + P2 */
+    _mzed_add(C12, C12, P[5]); _mzed_add(C12, C12, P[2]); /* C12 += U4 + P3 */
+    _mzed_add(C21, C21, P[6]); _mzed_add(C21, C21, P[3]); /* C21 += U3 + P4 */
+    _mzed_add(C22, C22, P[6]); _mzed_add(C22, C22, P[4]); /* C22 += U3 + P5 */
+  } else {
+    _mzed_add(C11, P[0], P[1]); /* C11 = P1 + P2 */
+    _mzed_add(C12, P[5], P[2]); /* C12 = U4 + P3 */
+    _mzed_add(C21, P[6], P[3]); /* C21 = U3 + P4 */
+    _mzed_add(C22, P[6], P[4]); /* C22 = U3 + P5 */
+  }
+
+  for(int i=0; i<7; i++)
+    _mzed_free_scratch(P[i]);
+
+  mzed_free_window(A11); mzed_free_window(A12);
+  mzed_free_window(A21); mzed_free_window(A22);
+
+  mzed_free_window(B11); mzed_free_window(B12);
+  mzed_free_window(B21); mzed_free_window(B22);
+
+  mzed_free_window(C11); mzed_free_window(C12);
+  mzed_free_window(C21); mzed_free_window(C22);
+
+  if (k > 2*kkk) {
+    /* overlaps with the quadrants, so this has to wait for the products */
+    mzed_t *A_last_col = mzed_init_window(A,   0, 2*kkk, 2*mmm, k);
+    mzed_t *B_last_row = mzed_init_window(B, 2*kkk,   0,     k, 2*nnn);
+    mzed_t *C_bulk = mzed_init_window(C, 0, 0, 2*mmm, 2*nnn);
+    _mzed_mul_newton_john(C_bulk, A_last_col, B_last_row);
+    mzed_free_window(A_last_col);
+    mzed_free_window(B_last_row);
+    mzed_free_window(C_bulk);
+  }
+}
+
+static mzed_t *_mzed_strassen_parallel(mzed_t *C, const mzed_t *A, const mzed_t *B, int cutoff, const int addmul) {
+  const int nthreads = m4rie_get_num_threads();
+
+  /* recurse in parallel until there are enough products to keep all threads busy */
+  int depth = 1;
+  for(int p = 7; p < nthreads && depth < __M4RIE_STRASSEN_TASK_DEPTH; p *= 7)
+    depth++;
+
+#ifdef HAVE_OPENMP
+#pragma omp parallel num_threads(nthreads)
+#pragma omp single
+#endif
+  _mzed_strassen_tasks(C, A, B, cutoff, depth, addmul);
+  return C;
+}
+
 rci_t _mzed_strassen_cutoff(const mzed_t *C, const mzed_t *A, const mzed_t *B) {
-  rci_t cutoff;
-
-  /* it seems most of it is cache bound: 2 matrix * (n^2 *w / 8 ) <= L2  */
-
-  switch(A->finite_field->degree) {
-
-  case 2:
-    cutoff = MIN(((int)sqrt((double)(4*__M4RI_CPU_L2_CACHE)))/2,4096);
-    break;
-  case  3:
-  case  4:
-  case  5:
-  case  6:
-  case  7:
-  case  8:
-    cutoff = MIN(((int)sqrt((double)(4*__M4RI_CPU_L2_CACHE/A->w))),4096);
-    break;
-
-  case  9:
-    /* on redhawk 2048 is much better, sage.math 1204 wins **/
-    cutoff = 2048;
-    break;
-
-  case 10:
-  case 11:
-  case 12:
-  case 13:
-  case 14:
-  case 15:
-  case 16:
-    cutoff = 4096;
-    break;
-
-  default:
-    cutoff = 1024;
-    break;
+  /* measured by m4rie-tune if a profile is loaded */
+  rci_t cutoff = m4rie_profile_get()->strassen[A->finite_field->degree];
+
+  if (cutoff == 0) {
+    /* it seems most of it is cache bound: 2 matrix * (n^2 *w / 8 ) <= L2  */
+
+    switch(A->finite_field->degree) {
+
+    case 2:
+      cutoff = MIN(((int)sqrt((double)(4*__M4RI_CPU_L2_CACHE)))/2,4096);
+      break;
+    case  3:
+    case  4:
+    case  5:
+    case  6:
+    case  7:
+    case  8:
+      cutoff = MIN(((int)sqrt((double)(4*__M4RI_CPU_L2_CACHE/A->w))),4096);
+      break;
+
+    case  9:
+      /* on redhawk 2048 is much better, sage.math 1204 wins **/
+      cutoff = 2048;
+      break;
+
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+      cutoff = 4096;
+      break;
+
+    default:
+      cutoff = 1024;
+      break;
+    }
   }
 
-  if (cutoff < 2*__M4RI_TWOPOW(A->finite_field->degree))
-    cutoff = 2*__M4RI_TWOPOW(A->finite_field->degree);
+  /* the base case should amortise building the Newton-John tables */
+  if (cutoff < 2*njt_mzed_rows(A->finite_field))
+    cutoff = 2*njt_mzed_rows(A->finite_field);
   return cutoff;
 }
@@ -60,6 +60,15 @@ mzed_t *mzed_mul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int cutof
 
 mzed_t *mzed_addmul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int cutoff);
 
+/**
+ * \brief Maximal number of Strassen-Winograd levels whose products run as parallel tasks.
+ *
+ * Each level gives seven times as many tasks and needs seven temporaries of a quarter of the size
+ * of C.
+ */
+
+#define __M4RIE_STRASSEN_TASK_DEPTH 2
+
 /**
  * \brief \f$ C = A \cdot B \f$ using Strassen-Winograd.
  *
@@ -67,6 +76,9 @@ mzed_t *mzed_addmul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int cu
  * variant) recursively until it reaches the cutoff, where it switches
  * to Newton-John table based multiplication or naive multiplication.
  *
+ * If M4RIE was built with OpenMP and the product is large enough (see m4rie_parallel_worthwhile())
+ * the top-level products run in parallel, see m4rie_set_num_threads().
+ *
  * \param C Preallocated product matrix.
  * \param A Input matrix A.
  * \param B Input matrix B.
@@ -85,6 +97,9 @@ mzed_t *_mzed_mul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B, int cuto
  * variant) recursively until it reaches the cutoff, where it switches
  * to Newton-John table based multiplication or naive multiplication.
  *
+ * If M4RIE was built with OpenMP and the product is large enough (see m4rie_parallel_worthwhile())
+ * the top-level products run in parallel, see m4rie_set_num_threads().
+ *
  * \param C Preallocated product matrix.
  * \param A Input matrix A.
  * \param B Input matrix B.
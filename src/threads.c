@@ -0,0 +1,54 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include "config.h"
+
+#ifdef HAVE_OPENMP
+#include <omp.h>
+#endif
+
+#include "threads.h"
+
+static int m4rie_num_threads = 0;
+
+void m4rie_set_num_threads(int n) {
+  if (n < 0)
+    m4ri_die("m4rie_set_num_threads: number of threads must be >= 0 but got %d.\n", n);
+  m4rie_num_threads = n;
+}
+
+int m4rie_get_num_threads(void) {
+#ifdef HAVE_OPENMP
+  if (m4rie_num_threads > 0)
+    return m4rie_num_threads;
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+int m4rie_parallel_worthwhile(const rci_t m, const rci_t l, const rci_t n) {
+#ifdef HAVE_OPENMP
+  if (m4rie_get_num_threads() <= 1 || omp_in_parallel())
+    return 0;
+  return ((double)m * (double)l * (double)n) >= (double)__M4RIE_PARALLEL_CUTOFF;
+#else
+  return 0;
+#endif
+}
@@ -0,0 +1,77 @@
+/**
+ * \file threads.h
+ * \brief Library-wide control over multicore parallelism.
+ *
+ * All parallel code paths in M4RIE are only compiled if the library
+ * was configured with --enable-openmp. Without OpenMP the functions
+ * in this file are still available but report a single thread.
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_THREADS_H
+#define M4RIE_THREADS_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <m4ri/m4ri.h>
+
+/**
+ * \brief Minimal number of bit operations (m*l*n) of a GF(2) product
+ * before it is worth running it on its own thread.
+ */
+
+#define __M4RIE_PARALLEL_CUTOFF (1<<24)
+
+/**
+ * \brief Limit the number of threads used by M4RIE.
+ *
+ * \param n Maximal number of threads or 0 to use the OpenMP default
+ * (OMP_NUM_THREADS).
+ *
+ * \note This setting is process-wide and should be changed outside
+ * of parallel regions.
+ */
+
+void m4rie_set_num_threads(int n);
+
+/**
+ * \brief Return the maximal number of threads M4RIE will use.
+ *
+ * Returns 1 if M4RIE was built without OpenMP support.
+ */
+
+int m4rie_get_num_threads(void);
+
+/**
+ * \brief Return true if a product of an m x l by an l x n matrix over
+ * GF(2) is large enough to be run in parallel with other products.
+ *
+ * This is false if M4RIE was built without OpenMP, if only one thread
+ * is available or if the caller already runs inside a parallel region.
+ *
+ * \param m Number of rows of the left operand.
+ * \param l Number of columns of the left operand.
+ * \param n Number of columns of the right operand.
+ */
+
+int m4rie_parallel_worthwhile(const rci_t m, const rci_t l, const rci_t n);
+
+#endif //M4RIE_THREADS_H
@@ -29,8 +29,9 @@
 
 #include <m4rie/mzed.h>
 #include <m4rie/mzd_slice.h>
+#include <m4rie/profile.h>
 
-#define MZED_TRSM_CUTOFF 512 /**< Crossover dimension to TRSM base cases */
+#define MZED_TRSM_CUTOFF 512 /**< Default crossover dimension to TRSM base cases, see m4rie_profile_t */
 
 /**
  * \brief \f$B = U^{-1} \cdot B\f$
@@ -65,7 +66,7 @@ void mzed_trsm_upper_left_naive(const mzed_t *U, mzed_t *B);
  */
 
 static inline void mzed_trsm_upper_left(const mzed_t *U, mzed_t *B) {
-  _mzed_trsm_upper_left(U, B, MZED_TRSM_CUTOFF);
+  _mzed_trsm_upper_left(U, B, m4rie_profile_get()->trsm);
 }
 
 /**
@@ -101,7 +102,7 @@ void mzd_slice_trsm_upper_left_naive(const mzd_slice_t *U, mzd_slice_t *B);
  */
 
 static inline void mzd_slice_trsm_upper_left(const mzd_slice_t *U, mzd_slice_t *B) {
-  _mzd_slice_trsm_upper_left(U, B, MZED_TRSM_CUTOFF);
+  _mzd_slice_trsm_upper_left(U, B, m4rie_profile_get()->trsm);
 }
 
 /**
@@ -137,7 +138,7 @@ void mzed_trsm_lower_left_naive(const mzed_t *L, mzed_t *B);
  */
 
 static inline void mzed_trsm_lower_left(const mzed_t *L, mzed_t *B) {
-  _mzed_trsm_lower_left(L, B, MZED_TRSM_CUTOFF);
+  _mzed_trsm_lower_left(L, B, m4rie_profile_get()->trsm);
 }
 
 /**
@@ -173,7 +174,7 @@ void mzd_slice_trsm_lower_left_naive(const mzd_slice_t *L, mzd_slice_t *B);
  */
 
 static inline void mzd_slice_trsm_lower_left(const mzd_slice_t *L, mzd_slice_t *B) {
-  _mzd_slice_trsm_lower_left(L, B, MZED_TRSM_CUTOFF);
+  _mzd_slice_trsm_lower_left(L, B, m4rie_profile_get()->trsm);
 }
 
 
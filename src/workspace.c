@@ -0,0 +1,189 @@
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include "config.h"
+
+#include <string.h>
+
+#include "workspace.h"
+
+static m4rie_workspace_t *m4rie_workspace_current = NULL;
+#ifdef HAVE_OPENMP
+#pragma omp threadprivate(m4rie_workspace_current)
+#endif
+
+static inline wi_t _m4rie_workspace_width(rci_t ncols) {
+  return (ncols + m4ri_radix - 1) / m4ri_radix;
+}
+
+static int _m4rie_workspace_block(m4rie_workspace_t *ws, rci_t ncols) {
+  const wi_t width = _m4rie_workspace_width(ncols);
+  for(int i=0; i<ws->nblocks; i++)
+    if (ws->blocks[i].width == width)
+      return i;
+
+  m4rie_workspace_block_t *blocks = (m4rie_workspace_block_t*)m4ri_mm_calloc(ws->nblocks + 1, sizeof(m4rie_workspace_block_t));
+  if (ws->nblocks) {
+    memcpy(blocks, ws->blocks, ws->nblocks * sizeof(m4rie_workspace_block_t));
+    m4ri_mm_free(ws->blocks);
+  }
+  ws->blocks = blocks;
+  ws->blocks[ws->nblocks].width = width;
+  return ws->nblocks++;
+}
+
+m4rie_workspace_t *m4rie_workspace_init(rci_t nrows, rci_t ncols) {
+  m4rie_workspace_t *ws = (m4rie_workspace_t*)m4ri_mm_calloc(1, sizeof(m4rie_workspace_t));
+  ws->size = 64;
+  ws->entries = (m4rie_workspace_entry_t*)m4ri_mm_malloc(ws->size * sizeof(m4rie_workspace_entry_t));
+  if (nrows > 0 && ncols > 0)
+    m4rie_workspace_reserve(ws, nrows, ncols);
+  return ws;
+}
+
+m4rie_workspace_t *m4rie_workspace_init_mul(const gf2e *ff, rci_t m, rci_t l, rci_t n) {
+  /* Karatsuba: the slices of A (m x l), B (l x n) and C (m x n) plus one product with its two
+     operands */
+  const rci_t e = ff->degree;
+  m4rie_workspace_t *ws = m4rie_workspace_init(0, 0);
+  if (_m4rie_workspace_width(l) == _m4rie_workspace_width(n)) {
+    m4rie_workspace_reserve(ws, (e + 1) * (2*m + l), n);
+  } else {
+    m4rie_workspace_reserve(ws, (e + 1) * m, l);
+    m4rie_workspace_reserve(ws, (e + 1) * (m + l), n);
+  }
+  return ws;
+}
+
+void m4rie_workspace_reserve(m4rie_workspace_t *ws, rci_t nrows, rci_t ncols) {
+  if (ws->depth)
+    m4ri_die("m4rie_workspace_reserve: %d matrices were not released.\n", ws->depth);
+  m4rie_workspace_block_t *b = ws->blocks + _m4rie_workspace_block(ws, ncols);
+  if (b->M && b->M->nrows >= nrows)
+    return;
+  if (b->M)
+    mzd_free(b->M);
+  b->M = mzd_init(nrows, b->width * m4ri_radix);
+}
+
+void m4rie_workspace_free(m4rie_workspace_t *ws) {
+  if (ws->depth)
+    m4ri_die("m4rie_workspace_free: %d matrices were not released.\n", ws->depth);
+  if (m4rie_workspace_current == ws)
+    m4rie_workspace_current = NULL;
+  for(int i=0; i<ws->nblocks; i++)
+    if (ws->blocks[i].M)
+      mzd_free(ws->blocks[i].M);
+  if (ws->nblocks)
+    m4ri_mm_free(ws->blocks);
+  m4ri_mm_free(ws->entries);
+  m4ri_mm_free(ws);
+}
+
+void m4rie_workspace_reset(m4rie_workspace_t *ws) {
+  for(int i=0; i<ws->depth; i++)
+    if (!ws->entries[i].released)
+      m4ri_die("m4rie_workspace_reset: %d matrices were not released.\n", ws->depth);
+  ws->depth = 0;
+
+  for(int i=0; i<ws->nblocks; i++) {
+    m4rie_workspace_block_t *b = ws->blocks + i;
+    b->top = 0;
+    b->used = 0;
+    if (b->peak > 0)
+      m4rie_workspace_reserve(ws, b->peak, b->width * m4ri_radix);
+  }
+}
+
+m4rie_workspace_t *m4rie_workspace_attach(m4rie_workspace_t *ws) {
+  m4rie_workspace_t *old = m4rie_workspace_current;
+  m4rie_workspace_current = ws;
+  return old;
+}
+
+m4rie_workspace_t *m4rie_workspace_get(void) {
+  return m4rie_workspace_current;
+}
+
+mzd_t *m4rie_workspace_mzd_init(m4rie_workspace_t *ws, rci_t m, rci_t n) {
+  if (ws == NULL || m == 0 || n == 0)
+    return mzd_init(m, n);
+
+  if (ws->depth == ws->size) {
+    m4rie_workspace_entry_t *entries = (m4rie_workspace_entry_t*)m4ri_mm_malloc(2 * ws->size * sizeof(m4rie_workspace_entry_t));
+    memcpy(entries, ws->entries, ws->size * sizeof(m4rie_workspace_entry_t));
+    m4ri_mm_free(ws->entries);
+    ws->entries = entries;
+    ws->size *= 2;
+  }
+
+  m4rie_workspace_entry_t *e = ws->entries + ws->depth++;
+  e->block = _m4rie_workspace_block(ws, n);
+  e->nrows = m;
+  e->released = 0;
+
+  m4rie_workspace_block_t *b = ws->blocks + e->block;
+  b->used += m;
+  if (b->used > b->peak)
+    b->peak = b->used;
+
+  if (b->M != NULL && b->top + m <= b->M->nrows) {
+    e->base = b->top;
+    e->A = mzd_init_window(b->M, b->top, 0, b->top + m, n);
+    mzd_set_ui(e->A, 0);
+    b->top += m;
+    ws->hits++;
+  } else {
+    e->base = -1;
+    e->A = mzd_init(m, n);
+    ws->misses++;
+  }
+  return e->A;
+}
+
+void m4rie_workspace_mzd_free(m4rie_workspace_t *ws, mzd_t *A) {
+  int i = (ws != NULL) ? ws->depth - 1 : -1;
+  while(i >= 0 && ws->entries[i].A != A)
+    i--;
+
+  if (i < 0) {
+    /* not ours, e.g. allocated before ws was attached */
+    mzd_free(A);
+    return;
+  }
+
+  m4rie_workspace_entry_t *e = ws->entries + i;
+  if (e->base < 0)
+    mzd_free(A);
+  else
+    mzd_free_window(A);
+  e->A = NULL;
+  e->released = 1;
+
+  while(ws->depth > 0 && ws->entries[ws->depth-1].released) {
+    e = ws->entries + --ws->depth;
+    m4rie_workspace_block_t *b = ws->blocks + e->block;
+    b->used -= e->nrows;
+    if (e->base >= 0)
+      b->top = e->base;
+  }
+
+  if (ws->depth == 0)
+    m4rie_workspace_reset(ws);
+}
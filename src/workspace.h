@@ -0,0 +1,263 @@
+/**
+ * \file workspace.h
+ * \brief Reusable memory for temporary matrices.
+ *
+ * A single multiplication or PLE decomposition creates and destroys many temporary matrices. A
+ * workspace is one preallocated block from which these temporaries are cut as windows, so that
+ * repeated calls of similar size do not go through the allocator and do not fault in new pages.
+ *
+ * A workspace is either used explicitly through m4rie_workspace_mzd_init() or attached to the
+ * calling thread with m4rie_workspace_attach(), in which case all temporaries of M4RIE functions
+ * called from this thread are taken from it. Temporaries which do not fit are allocated as usual
+ * and the workspace grows to the observed peak demand once it is empty again, so that the next
+ * call of the same size is served from the workspace entirely.
+ *
+ * Matrices are cut from blocks of matching width so that their rows are as densely packed as
+ * those of matrices returned by mzd_init().
+ *
+ * \author Martin Albrecht <martinralbrecht@googlemail.com>
+ */
+
+#ifndef M4RIE_WORKSPACE_H
+#define M4RIE_WORKSPACE_H
+
+/******************************************************************************
+*
+*            M4RIE: Linear Algebra over GF(2^e)
+*
+*    Copyright (C) 2014 Martin Albrecht <martinralbrecht@googlemail.com>
+*
+*  Distributed under the terms of the GNU General Public License (GEL)
+*  version 2 or higher.
+*
+*    This code is distributed in the hope that it will be useful,
+*    but WITHOUT ANY WARRANTY; without even the implied warranty of
+*    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*    General Public License for more details.
+*
+*  The full text of the GPL is available at:
+*
+*                  http://www.gnu.org/licenses/
+******************************************************************************/
+
+#include <m4ri/m4ri.h>
+#include <m4rie/mzed.h>
+#include <m4rie/mzd_slice.h>
+
+/**
+ * \brief Rows of one width from which temporary matrices are cut.
+ */
+
+typedef struct {
+  mzd_t *M;         /**< Backing block or NULL. */
+  wi_t width;       /**< Number of words per row of matrices served from this block. */
+  rci_t top;        /**< First free row of M. */
+  rci_t used;       /**< Number of rows of all live matrices of this width. */
+  rci_t peak;       /**< Maximum of used since M was allocated. */
+} m4rie_workspace_block_t;
+
+/**
+ * \brief A temporary matrix handed out by a workspace.
+ */
+
+typedef struct {
+  mzd_t *A;       /**< The matrix, a window into a block or allocated with mzd_init(). */
+  int block;      /**< Index of the block of matching width. */
+  rci_t base;     /**< First row of A in the block, or -1 if A was allocated with mzd_init(). */
+  rci_t nrows;    /**< Number of rows of A. */
+  int released;   /**< A was given back but sits below a live matrix. */
+} m4rie_workspace_entry_t;
+
+/**
+ * \brief Stack allocator for temporary GF(2) matrices.
+ *
+ * Matrices are cut from consecutive rows of the block of their width. Releasing matrices in
+ * reverse order of allocation returns their rows immediately, otherwise rows are returned once
+ * everything allocated later was released.
+ */
+
+typedef struct {
+  m4rie_workspace_block_t *blocks;  /**< One block per width seen so far. */
+  int nblocks;                      /**< Number of blocks. */
+  m4rie_workspace_entry_t *entries; /**< Live matrices in order of allocation. */
+  int depth;                        /**< Number of entries. */
+  int size;                         /**< Capacity of entries. */
+  size_t hits;                      /**< Number of matrices served from a block. */
+  size_t misses;                    /**< Number of matrices allocated with mzd_init(). */
+} m4rie_workspace_t;
+
+/**
+ * \brief Create a new workspace.
+ *
+ * \param nrows Number of rows of matrices with ncols columns the workspace can hold, may be 0.
+ * \param ncols Number of columns (bits) of these matrices, may be 0.
+ *
+ * \sa m4rie_workspace_init_mul() m4rie_workspace_reserve()
+ */
+
+m4rie_workspace_t *m4rie_workspace_init(rci_t nrows, rci_t ncols);
+
+/**
+ * \brief Create a workspace sized for the bitsliced operands and temporaries of C = A*B.
+ *
+ * \param ff Finite field.
+ * \param m Number of rows of A.
+ * \param l Number of columns of A.
+ * \param n Number of columns of B.
+ */
+
+m4rie_workspace_t *m4rie_workspace_init_mul(const gf2e *ff, rci_t m, rci_t l, rci_t n);
+
+/**
+ * \brief Make sure ws can hold nrows rows of matrices with ncols columns.
+ *
+ * \param ws Workspace without live matrices.
+ * \param nrows Number of rows.
+ * \param ncols Number of columns (bits).
+ */
+
+void m4rie_workspace_reserve(m4rie_workspace_t *ws, rci_t nrows, rci_t ncols);
+
+/**
+ * \brief Free a workspace.
+ *
+ * All matrices taken from ws must have been released. If ws is attached to the calling thread it
+ * is detached.
+ *
+ * \param ws Workspace.
+ */
+
+void m4rie_workspace_free(m4rie_workspace_t *ws);
+
+/**
+ * \brief Forget all matrices taken from ws and grow it to the peak demand seen so far.
+ *
+ * This happens automatically whenever the last live matrix is released.
+ *
+ * \param ws Workspace.
+ */
+
+void m4rie_workspace_reset(m4rie_workspace_t *ws);
+
+/**
+ * \brief Take temporaries of M4RIE functions called by this thread from ws.
+ *
+ * If M4RIE was built with OpenMP every thread has its own attached workspace, otherwise there is
+ * one for the whole process. Threads started by M4RIE itself have none.
+ *
+ * \param ws Workspace or NULL to detach.
+ *
+ * \return The previously attached workspace.
+ */
+
+m4rie_workspace_t *m4rie_workspace_attach(m4rie_workspace_t *ws);
+
+/**
+ * \brief Return the workspace attached to this thread or NULL.
+ */
+
+m4rie_workspace_t *m4rie_workspace_get(void);
+
+/**
+ * \brief Return a zero m x n matrix taken from ws.
+ *
+ * \param ws Workspace, if NULL mzd_init() is used.
+ * \param m Number of rows.
+ * \param n Number of columns.
+ *
+ * \sa m4rie_workspace_mzd_free()
+ */
+
+mzd_t *m4rie_workspace_mzd_init(m4rie_workspace_t *ws, rci_t m, rci_t n);
+
+/**
+ * \brief Release a matrix obtained from m4rie_workspace_mzd_init().
+ *
+ * \param ws Workspace the matrix was taken from.
+ * \param A Matrix.
+ */
+
+void m4rie_workspace_mzd_free(m4rie_workspace_t *ws, mzd_t *A);
+
+/**
+ * \brief Return a zero m x n temporary matrix from the workspace of this thread.
+ *
+ * \param m Number of rows.
+ * \param n Number of columns.
+ */
+
+static inline mzd_t *_mzd_init_scratch(rci_t m, rci_t n) {
+  return m4rie_workspace_mzd_init(m4rie_workspace_get(), m, n);
+}
+
+/**
+ * \brief Release a matrix obtained from _mzd_init_scratch().
+ *
+ * \param A Matrix.
+ */
+
+static inline void _mzd_free_scratch(mzd_t *A) {
+  m4rie_workspace_mzd_free(m4rie_workspace_get(), A);
+}
+
+/**
+ * \brief Return a zero m x n temporary matrix over ff from the workspace of this thread.
+ *
+ * \param ff Finite field.
+ * \param m Number of rows.
+ * \param n Number of columns.
+ */
+
+static inline mzed_t *_mzed_init_scratch(const gf2e *ff, rci_t m, rci_t n) {
+  mzed_t *A = (mzed_t *)m4ri_mm_malloc(sizeof(mzed_t));
+  A->finite_field = ff;
+  A->w = gf2e_degree_to_w(ff);
+  A->nrows = m;
+  A->ncols = n;
+  A->x = _mzd_init_scratch(m, A->w*n);
+  return A;
+}
+
+/**
+ * \brief Release a matrix obtained from _mzed_init_scratch().
+ *
+ * \param A Matrix.
+ */
+
+static inline void _mzed_free_scratch(mzed_t *A) {
+  _mzd_free_scratch(A->x);
+  m4ri_mm_free(A);
+}
+
+/**
+ * \brief Return a zero m x n temporary bitsliced matrix over ff from the workspace of this thread.
+ *
+ * \param ff Finite field.
+ * \param m Number of rows.
+ * \param n Number of columns.
+ */
+
+static inline mzd_slice_t *_mzd_slice_init_scratch(const gf2e *ff, rci_t m, rci_t n) {
+  mzd_slice_t *A = (mzd_slice_t*)m4ri_mm_malloc(sizeof(mzd_slice_t));
+  A->finite_field = ff;
+  A->nrows = m;
+  A->ncols = n;
+  A->depth = ff->degree;
+  for(int i=0; i<A->depth; i++)
+    A->x[i] = _mzd_init_scratch(m, n);
+  return A;
+}
+
+/**
+ * \brief Release a matrix obtained from _mzd_slice_init_scratch().
+ *
+ * \param A Matrix.
+ */
+
+static inline void _mzd_slice_free_scratch(mzd_slice_t *A) {
+  for(int i=A->depth-1; i>=0; i--)
+    _mzd_free_scratch(A->x[i]);
+  m4ri_mm_free(A);
+}
+
+#endif //M4RIE_WORKSPACE_H
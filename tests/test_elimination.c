@@ -66,6 +66,46 @@ int test_equality(gf2e *ff, rci_t m, rci_t n) {
   return fail_ret;
 }
 
+int test_threads(gf2e *ff, rci_t m, rci_t n) {
+  int fail_ret = 0;
+  printf("elim: k: %2d, minpoly: 0x%05x m: %5d, n: %5d threads ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)n);
+
+  for(int full=0; full<2; full++) {
+    mzed_t *A0 = random_mzed_t(ff, m, n);
+    mzed_t *A1 = mzed_copy(NULL, A0);
+    mzed_t *A2 = mzed_copy(NULL, A0);
+    mzed_set_canary(A1);
+    mzed_set_canary(A2);
+
+    const rci_t r0 = mzed_echelonize_naive(A0, full);
+    m4rie_set_num_threads(1);
+    const rci_t r1 = mzed_echelonize_newton_john(A1, full);
+    m4rie_set_num_threads(4);
+    const rci_t r2 = mzed_echelonize_newton_john(A2, full);
+    m4rie_set_num_threads(0);
+
+    /* only reduced echelon forms are unique */
+    m4rie_check( (r0 == r1 && r0 == r2) ); printf("."); fflush(0);
+    if (full) {
+      m4rie_check( mzed_cmp(A0, A1) == 0); printf("."); fflush(0);
+    }
+    m4rie_check( mzed_cmp(A1, A2) == 0); printf("."); fflush(0);
+    m4rie_check( mzed_canary_is_alive(A1) ); printf("."); fflush(0);
+    m4rie_check( mzed_canary_is_alive(A2) ); printf("."); fflush(0);
+
+    mzed_free(A0);
+    mzed_free(A1);
+    mzed_free(A2);
+  }
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
 int test_batch(gf2e *ff, rci_t m, rci_t n) {
   int fail_ret = 0;
   printf("elim: k: %2d, minpoly: 0x%05x m: %5d, n: %5d ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)n);
@@ -122,6 +162,8 @@ int main(int argc, char **argv) {
       fail_ret += test_batch(ff, 200, 112);
       fail_ret += test_batch(ff,  10, 200);
     }
+    if (k <= 8 || runlong)
+      fail_ret += test_threads(ff, 520, 530);
     gf2e_free(ff);
   }
 
@@ -103,6 +103,11 @@ int test_mul(gf2e *ff, rci_t m, rci_t n, rci_t l) {
   m4rie_check( mzed_cmp(C3, C4) == 0);
   m4rie_check( mzed_cmp(C4, C5) == 0);
 
+  /* a new C is zero */
+  mzed_t *C6 = _mzed_addmul_karatsuba(NULL, A, B);
+  m4rie_check( mzed_cmp(C4, C6) == 0);
+  mzed_free(C6);
+
   m4rie_check( mzed_canary_is_alive((mzed_t*)A) );
   m4rie_check( mzed_canary_is_alive((mzed_t*)B) );
   m4rie_check( mzed_canary_is_alive(C1) );
@@ -218,6 +223,656 @@ int test_batch(gf2e *ff, rci_t m, rci_t l, rci_t n) {
   return fail_ret;
 }
 
+typedef mzed_t *(*mul_f)(mzed_t *C, const mzed_t *A, const mzed_t *B);
+
+/**
+ * Compute A*B and C + A*B with mul and addmul for every thread count in threads and compare with
+ * ref_mul and ref_addmul, or with the results for threads[0] if no reference is given.
+ */
+
+int test_mul_threads(gf2e *ff, rci_t m, rci_t l, rci_t n, const char *name,
+                     mul_f mul, mul_f addmul, mul_f ref_mul, mul_f ref_addmul,
+                     const int *threads, int nthreads) {
+  int fail_ret = 0;
+  printf("mul: k: %2d, minpoly: 0x%05x m: %5d, l: %5d, n: %5d %s ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)l, (int)n, name);
+
+  mzed_t *A = random_mzed_t(ff, m, l);
+  mzed_t *B = random_mzed_t(ff, l, n);
+  mzed_t *D = random_mzed_t(ff, m, n);
+
+  mzed_t *C0 = NULL;
+  mzed_t *D0 = NULL;
+  if (ref_mul) {
+    C0 = ref_mul(NULL, A, B);
+    D0 = ref_addmul(mzed_copy(NULL, D), A, B);
+  }
+
+  for(int i=0; i<nthreads; i++) {
+    mzed_t *C1 = random_mzed_t(ff, m, n);
+    mzed_t *D1 = mzed_copy(NULL, D);
+    mzed_set_canary(D1);
+
+    m4rie_set_num_threads(threads[i]);
+    mul(C1, A, B);
+    addmul(D1, A, B);
+    m4rie_set_num_threads(0);
+
+    if (C0 == NULL) {
+      C0 = C1;
+      D0 = D1;
+    } else {
+      m4rie_check( mzed_cmp(C0, C1) == 0); printf("."); fflush(0);
+      m4rie_check( mzed_cmp(D0, D1) == 0); printf("."); fflush(0);
+    }
+    m4rie_check( mzed_canary_is_alive(C1) ); printf("."); fflush(0);
+    m4rie_check( mzed_canary_is_alive(D1) ); printf("."); fflush(0);
+
+    if (C0 != C1) {
+      mzed_free(C1);
+      mzed_free(D1);
+    }
+  }
+
+  m4rie_check( mzed_canary_is_alive(A) );
+  m4rie_check( mzed_canary_is_alive(B) );
+
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(D);
+  mzed_free(C0);
+  mzed_free(D0);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
+static mzed_t *_mul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B) {
+  return mzed_mul_strassen(C, A, B, 64);
+}
+
+static mzed_t *_addmul_strassen(mzed_t *C, const mzed_t *A, const mzed_t *B) {
+  return mzed_addmul_strassen(C, A, B, 64);
+}
+
+static mzed_t *_mul_karatsuba_tiled(mzed_t *C, const mzed_t *A, const mzed_t *B) {
+  return _mzed_mul_karatsuba_tiled(C, A, B, 64);
+}
+
+static mzed_t *_addmul_karatsuba_tiled(mzed_t *C, const mzed_t *A, const mzed_t *B) {
+  return _mzed_addmul_karatsuba_tiled(C, A, B, 64);
+}
+
+/**
+ * Use bilinear maps for bitsliced products of any size and stream their pointwise products.
+ */
+
+static void _set_blm_stream_profile(const gf2e *ff) {
+  m4rie_profile_t p;
+  m4rie_profile_defaults(&p);
+  p.blm[ff->degree] = 1;
+  p.blm_stream = 0;
+  m4rie_profile_set(&p);
+}
+
+static mzed_t *_mul_blm_stream(mzed_t *C, const mzed_t *A, const mzed_t *B) {
+  _set_blm_stream_profile(A->finite_field);
+  C = mzed_mul_blm(C, A, B);
+  m4rie_profile_set(NULL);
+  return C;
+}
+
+static mzed_t *_addmul_blm_stream(mzed_t *C, const mzed_t *A, const mzed_t *B) {
+  _set_blm_stream_profile(A->finite_field);
+  C = mzed_addmul_blm(C, A, B);
+  m4rie_profile_set(NULL);
+  return C;
+}
+
+/* G*B is prepared, so the streamed products do not transform B */
+
+static mzed_t *_addmul_blm_stream_prepared(mzed_t *C, const mzed_t *A, const mzed_t *B) {
+  _set_blm_stream_profile(A->finite_field);
+  mzed_prepared_t *P = mzed_prepared_init(B);
+  mzd_slice_t *a = mzed_slice(NULL, A);
+  mzd_slice_t *c = mzed_slice(NULL, C);
+  mzd_slice_addmul_prepared(c, a, P);
+  mzed_cling(C, c);
+  mzd_slice_free(a);
+  mzd_slice_free(c);
+  mzed_prepared_free(P);
+  m4rie_profile_set(NULL);
+  return C;
+}
+
+static mzed_t *_mul_blm_stream_prepared(mzed_t *C, const mzed_t *A, const mzed_t *B) {
+  mzed_set_ui(C, 0);
+  return _addmul_blm_stream_prepared(C, A, B);
+}
+
+/**
+ * Add A[i,c] times row r of A from column c on to every row i of a copy of A, using a Newton-John
+ * table if T is not NULL.
+ */
+
+static mzed_t *_njt_products(const mzed_t *A, njt_mzed_t *T, rci_t r, rci_t c) {
+  mzed_t *C = mzed_copy(NULL, A);
+  mzed_set_canary(C);
+  if (T)
+    mzed_make_table(T, A, r, c);
+  for(rci_t i=0; i<A->nrows; i++) {
+    const word a = mzed_read_elem(A, i, c);
+    if (T)
+      njt_mzed_addmul_row(C, i, T, a);
+    else
+      mzed_add_multiple_of_row(C, i, A, r, a, c);
+  }
+  return C;
+}
+
+int test_newton_john_pool(gf2e *ff, rci_t m, rci_t n) {
+  int fail_ret = 0;
+  printf("mul: k: %2d, minpoly: 0x%05x m: %5d, n: %5d newton-john pool ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)n);
+
+  /* another field of the same degree if there is one, and a field of another degree */
+  const deg_t e = ff->degree;
+  gf2e *ff2 = gf2e_init(irreducible_polynomials[e][irreducible_polynomials[e][0]]);
+  gf2e *ff3 = gf2e_init(irreducible_polynomials[(e < 16) ? e+1 : e-1][1]);
+
+  mzed_t *A = random_mzed_t(ff, m, n);
+  mzed_t *A2 = random_mzed_t(ff2, m, n);
+  mzed_t *C0 = _njt_products(A, NULL, 0, 0);
+  mzed_t *D0 = _njt_products(A2, NULL, 0, 0);
+
+  njt_mzed_pool_clear();
+  m4rie_check( (njt_mzed_pool_size() == 0) );
+
+  /* a fresh table */
+  njt_mzed_t *T = njt_mzed_init(ff, n);
+  mzed_t *C1 = _njt_products(A, T, 0, 0);
+  njt_mzed_free(T);
+  const size_t bytes = njt_mzed_pool_size();
+  m4rie_check( (bytes > 0) );
+  m4rie_check( mzed_cmp(C0, C1) == 0 ); printf("."); fflush(0);
+
+  /* nothing is reused for another number of columns or another degree */
+  njt_mzed_t *U = njt_mzed_init(ff, n+1);
+  njt_mzed_t *V = njt_mzed_init(ff3, n);
+  m4rie_check( (njt_mzed_pool_size() == bytes) ); printf("."); fflush(0);
+  njt_mzed_free(U);
+  njt_mzed_free(V);
+
+  /* a reused table gives the same products as a fresh one, whatever it was used for before */
+  const size_t all = njt_mzed_pool_size();
+  T = njt_mzed_init(ff, n);
+  m4rie_check( (njt_mzed_pool_size() == all - bytes) ); printf("."); fflush(0);
+  mzed_t *E0 = _njt_products(A, NULL, 1, n/2);
+  mzed_t *E1 = _njt_products(A, T, 1, n/2);
+  mzed_t *C2 = _njt_products(A, T, 0, 0);
+  njt_mzed_free(T);
+  m4rie_check( mzed_cmp(E0, E1) == 0 );
+  m4rie_check( mzed_cmp(C0, C2) == 0 );
+  m4rie_check( mzed_canary_is_alive(E1) );
+  m4rie_check( mzed_canary_is_alive(C2) ); printf("."); fflush(0);
+
+  /* and is rebound to another field of the same degree */
+  T = njt_mzed_init(ff2, n);
+  m4rie_check( (njt_mzed_pool_size() == all - bytes) );
+  mzed_t *D1 = _njt_products(A2, T, 0, 0);
+  njt_mzed_free(T);
+  m4rie_check( mzed_cmp(D0, D1) == 0 ); printf("."); fflush(0);
+
+  /* tables which do not fit into the free list of this thread are kept in the shared overflow */
+  njt_mzed_pool_clear();
+  njt_mzed_t *W[__M4RIE_NJT_LOCAL_SIZE + 2];
+  for(int i=0; i<__M4RIE_NJT_LOCAL_SIZE + 2; i++)
+    W[i] = njt_mzed_init(ff, n);
+  for(int i=0; i<__M4RIE_NJT_LOCAL_SIZE + 2; i++)
+    njt_mzed_free(W[i]);
+  m4rie_check( (njt_mzed_pool_size() == (__M4RIE_NJT_LOCAL_SIZE + 2) * bytes) );
+  for(int i=0; i<__M4RIE_NJT_LOCAL_SIZE + 2; i++)
+    W[i] = njt_mzed_init(ff, n);
+  m4rie_check( (njt_mzed_pool_size() == 0) ); printf("."); fflush(0);
+  for(int i=0; i<__M4RIE_NJT_LOCAL_SIZE + 2; i++)
+    njt_mzed_free(W[i]);
+
+  njt_mzed_pool_clear();
+  m4rie_check( (njt_mzed_pool_size() == 0) ); printf("."); fflush(0);
+
+  mzed_free(A);
+  mzed_free(A2);
+  mzed_free(C0);
+  mzed_free(C1);
+  mzed_free(C2);
+  mzed_free(D0);
+  mzed_free(D1);
+  mzed_free(E0);
+  mzed_free(E1);
+  gf2e_free(ff2);
+  gf2e_free(ff3);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
+int test_blm_cache(gf2e *ff, rci_t m, rci_t l, rci_t n) {
+  int fail_ret = 0;
+  printf("mul: k: %2d, minpoly: 0x%05x m: %5d, l: %5d, n: %5d blm cache ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)l, (int)n);
+
+  blm_cache_warm(ff);
+  const blm_t *f = blm_cache_get_field(ff);
+  m4rie_check( (f == blm_cache_get_field(ff)) ); printf("."); fflush(0);
+
+  gf2e *ff2 = gf2e_init(ff->minpoly);
+  m4rie_check( (f == blm_cache_get_field(ff2)) ); printf("."); fflush(0);
+
+  mzed_t *A = random_mzed_t(ff2, m, l);
+  mzed_t *B = random_mzed_t(ff2, l, n);
+  mzed_t *C0 = mzed_mul_blm(NULL, A, B);
+  mzed_t *C1 = mzed_mul_naive(NULL, A, B);
+  m4rie_check( mzed_cmp(C0, C1) == 0); printf("."); fflush(0);
+
+  blm_cache_clear();
+  mzed_t *C2 = mzed_mul_blm(NULL, A, B);
+  m4rie_check( mzed_cmp(C0, C2) == 0); printf("."); fflush(0);
+
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(C0);
+  mzed_free(C1);
+  mzed_free(C2);
+  gf2e_free(ff2);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
+int test_blm_stream(gf2e *ff, rci_t m, rci_t l, rci_t n) {
+  int fail_ret = 0;
+  printf("mul: k: %2d, minpoly: 0x%05x m: %5d, l: %5d, n: %5d blm stream ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)l, (int)n);
+
+  const blm_t *f = blm_cache_get_field(ff);
+
+  mzd_slice_t *A = random_mzd_slice_t(ff, m, l);
+  mzd_slice_t *B = random_mzd_slice_t(ff, l, n);
+  mzd_slice_t *C = mzd_slice_mul_karatsuba(NULL, A, B);
+
+  /* X is overwritten whether the products are kept or streamed */
+  mzd_slice_t *X0 = random_mzd_slice_t(ff, m, n);
+  mzd_slice_t *X1 = random_mzd_slice_t(ff, m, n);
+  mzd_slice_t *X2 = random_mzd_slice_t(ff, m, n);
+  mzd_t **GB = _mzd_ptr_blm_prepare((const mzd_t**)B->x, f);
+
+  _mzd_ptr_apply_blm(X0->x, (const mzd_t**)A->x, (const mzd_t**)B->x, f);
+  _set_blm_stream_profile(ff);
+  _mzd_ptr_apply_blm(X1->x, (const mzd_t**)A->x, (const mzd_t**)B->x, f);
+  _mzd_ptr_apply_blm_prepared(X2->x, (const mzd_t**)A->x, (const mzd_t**)GB, f);
+  m4rie_profile_set(NULL);
+
+  m4rie_check( mzd_slice_cmp(C, X0) == 0); printf("."); fflush(0);
+  m4rie_check( mzd_slice_cmp(C, X1) == 0); printf("."); fflush(0);
+  m4rie_check( mzd_slice_cmp(C, X2) == 0); printf("."); fflush(0);
+
+  _mzd_ptr_blm_prepared_free(GB, f);
+  mzd_slice_free(A);
+  mzd_slice_free(B);
+  mzd_slice_free(C);
+  mzd_slice_free(X0);
+  mzd_slice_free(X1);
+  mzd_slice_free(X2);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
+int test_profile(gf2e *ff, rci_t m, rci_t l, rci_t n) {
+  int fail_ret = 0;
+  printf("mul: k: %2d, minpoly: 0x%05x m: %5d, l: %5d, n: %5d profile ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)l, (int)n);
+
+  const char *filename = "test_multiplication.profile";
+
+  /* small crossovers, so that every algorithm is reached */
+  m4rie_profile_t p;
+  m4rie_profile_defaults(&p);
+  p.karatsuba[ff->degree] = 64;
+  p.blm[ff->degree] = 96;
+  p.strassen[ff->degree] = 64;
+
+  FILE *fh = fopen(filename, "w");
+  m4rie_profile_write(&p, fh);
+  fprintf(fh, "trsm 77\ntrsm_newton_john %d 33\n", ff->degree);
+  fclose(fh);
+  m4rie_check( (m4rie_profile_load(filename) == 0) ); printf("."); fflush(0);
+  m4rie_check( (m4rie_profile_get()->karatsuba[ff->degree] == 64) );
+  m4rie_check( (m4rie_profile_get()->blm[ff->degree] == 96) );
+  m4rie_check( (m4rie_profile_get()->strassen[ff->degree] == 64) );
+  m4rie_check( (m4rie_profile_get()->trsm == 77) );
+  m4rie_check( (m4rie_profile_get()->trsm_newton_john[ff->degree] == 33) );
+  m4rie_check( (m4rie_profile_get()->ple == p.ple) ); printf("."); fflush(0);
+
+  fh = fopen(filename, "w");
+  fprintf(fh, "karatsuba %d 128\nsomething 1\n", ff->degree);
+  fclose(fh);
+  m4rie_check( (m4rie_profile_load(filename) == -1) );
+  m4rie_check( (m4rie_profile_get()->karatsuba[ff->degree] == 64) ); printf("."); fflush(0);
+  remove(filename);
+
+  mzed_t *A = random_mzed_t(ff, m, l);
+  mzed_t *B = random_mzed_t(ff, l, n);
+  mzed_t *C0 = mzed_mul_naive(NULL, A, B);
+  mzed_t *C1 = mzed_mul(NULL, A, B);
+  m4rie_check( mzed_cmp(C0, C1) == 0); printf("."); fflush(0);
+
+  mzd_slice_t *a = mzed_slice(NULL, A);
+  mzd_slice_t *b = mzed_slice(NULL, B);
+  mzd_slice_t *c = mzd_slice_mul(NULL, a, b);
+  mzd_slice_addmul(c, a, b);
+  m4rie_check( mzd_slice_is_zero(c) ); printf("."); fflush(0);
+
+  m4rie_profile_set(NULL);
+  m4rie_check( (m4rie_profile_get()->karatsuba[ff->degree] == 512) );
+
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(C0);
+  mzed_free(C1);
+  mzd_slice_free(a);
+  mzd_slice_free(b);
+  mzd_slice_free(c);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
+int test_scalar_cache(gf2e *ff, rci_t m, rci_t n) {
+  int fail_ret = 0;
+  printf("mul: k: %2d, minpoly: 0x%05x m: %5d, n: %5d scalar cache ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)n);
+
+  const word mask = __M4RI_TWOPOW(ff->degree) - 1;
+
+  /* holding a table pins it, once all slots are pinned tables are private */
+  const gf2e_t16_t *t[__M4RIE_T16_CACHE_SIZE + 1];
+  for(int i=0; i<__M4RIE_T16_CACHE_SIZE + 1; i++)
+    t[i] = gf2e_t16_get(ff, (i + 1) & mask);
+  m4rie_check( (t[0] == gf2e_t16_get(ff, 1)) ); printf("."); fflush(0);
+  gf2e_t16_release(ff, t[0]);
+  for(int i=0; i<__M4RIE_T16_CACHE_SIZE + 1; i++) {
+    m4rie_check( (t[i]->a == ((i + 1) & mask)) );
+    gf2e_t16_release(ff, t[i]);
+  }
+  printf("."); fflush(0);
+
+  /* more scalars than slots, so entries get evicted and rebuilt */
+  mzed_t *B = random_mzed_t(ff, m, n);
+  mzed_t *C0 = mzed_init(ff, m, n);
+  mzed_t *C1 = mzed_init(ff, m, n);
+  for(int r=0; r<2; r++) {
+    for(int i=0; i<2*__M4RIE_T16_CACHE_SIZE + 1; i++) {
+      const word a = random() & mask;
+      mzed_mul_scalar(C0, a, B);
+      mzed_copy(C1, B);
+      for(rci_t j=0; j<m; j++)
+        mzed_rescale_row(C1, j, 0, a);
+      m4rie_check( mzed_cmp(C0, C1) == 0);
+    }
+    printf("."); fflush(0);
+  }
+
+  mzed_free(B);
+  mzed_free(C0);
+  mzed_free(C1);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
+int test_workspace(gf2e *ff, rci_t m, rci_t l, rci_t n) {
+  int fail_ret = 0;
+  printf("mul: k: %2d, minpoly: 0x%05x m: %5d, l: %5d, n: %5d workspace ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)l, (int)n);
+
+  mzed_t *A = random_mzed_t(ff, m, l);
+  mzed_t *B = random_mzed_t(ff, l, n);
+  mzed_t *D = random_mzed_t(ff, m, n);
+
+  mzed_t *C0 = mzed_mul_karatsuba(NULL, A, B);
+  mzed_t *C1 = mzed_mul_strassen(NULL, A, B, 64);
+  mzed_t *D0 = mzed_addmul_karatsuba(mzed_copy(NULL, D), A, B);
+
+  /* start empty, the first round sizes the workspace, the second must be served from it; the
+     third uses threads whose temporaries do not come from ws */
+  m4rie_workspace_t *ws = m4rie_workspace_init(0, 0);
+  m4rie_workspace_t *old = m4rie_workspace_attach(ws);
+
+  size_t misses = 0;
+  m4rie_set_num_threads(1);
+  for(int i=0; i<3; i++) {
+    if (i == 2)
+      m4rie_set_num_threads(0);
+    mzed_t *C2 = mzed_mul_karatsuba(NULL, A, B);
+    mzed_t *C3 = mzed_mul_strassen(NULL, A, B, 64);
+    mzed_t *D1 = mzed_addmul_karatsuba(mzed_copy(NULL, D), A, B);
+
+    m4rie_check( mzed_cmp(C0, C2) == 0); printf("."); fflush(0);
+    m4rie_check( mzed_cmp(C1, C3) == 0); printf("."); fflush(0);
+    m4rie_check( mzed_cmp(D0, D1) == 0); printf("."); fflush(0);
+    m4rie_check( ws->depth == 0); printf("."); fflush(0);
+
+    mzed_free(C2);
+    mzed_free(C3);
+    mzed_free(D1);
+
+    if (i == 0) {
+      misses = ws->misses;
+    } else if (i == 1) {
+      m4rie_check( (ws->misses == misses) ); printf("."); fflush(0);
+      m4rie_check( (ws->hits > 0) ); printf("."); fflush(0);
+    }
+  }
+
+  m4rie_workspace_attach(old);
+  m4rie_workspace_free(ws);
+
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(D);
+  mzed_free(C0);
+  mzed_free(C1);
+  mzed_free(D0);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
+int test_plan(gf2e *ff, rci_t m, rci_t l, rci_t n) {
+  int fail_ret = 0;
+  printf("mul: k: %2d, minpoly: 0x%05x m: %5d, l: %5d, n: %5d plan ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)l, (int)n);
+
+  mzed_t *A = random_mzed_t(ff, m, l);
+  mzed_t *B = random_mzed_t(ff, l, n);
+  mzed_t *D = random_mzed_t(ff, m, n);
+  mzd_slice_t *a = mzed_slice(NULL, A);
+  mzd_slice_t *b = mzed_slice(NULL, B);
+
+  mzed_t *C0 = mzed_mul_naive(NULL, A, B);
+  mzed_t *D0 = mzed_addmul_naive(mzed_copy(NULL, D), A, B);
+
+  mzed_t *C1 = mzed_init(ff, m, n);
+  mzd_slice_t *c = mzd_slice_init(ff, m, n);
+
+  /* small crossovers, so that Karatsuba and bilinear maps are planned too */
+  m4rie_profile_t p;
+  m4rie_profile_defaults(&p);
+  p.karatsuba[ff->degree] = 64;
+  p.blm[ff->degree] = 64;
+
+  for(int i=0; i<6; i++) {
+    /* single threaded plans are served from their workspace entirely */
+    m4rie_set_num_threads((i & 1) ? 0 : 1);
+    m4rie_profile_set((i >> 1) == 1 ? &p : NULL);
+    const int flags = ((i >> 1) == 2) ? M4RIE_PLAN_MEASURE : M4RIE_PLAN_ESTIMATE;
+
+    mzed_mul_plan_t *plan = mzed_mul_plan_init(ff, m, l, n, flags);
+    mzd_slice_mul_plan_t *splan = mzd_slice_mul_plan_init(ff, m, l, n, flags);
+    const size_t misses = plan->ws[0]->misses;
+    const size_t smisses = splan->ws[0]->misses;
+
+    for(int j=0; j<2; j++) {
+      mzed_set_ui(C1, 1);
+      mzed_mul_execute(plan, C1, A, B);
+      m4rie_check( mzed_cmp(C0, C1) == 0); printf("."); fflush(0);
+
+      mzed_copy(C1, D);
+      mzed_addmul_execute(plan, C1, A, B);
+      m4rie_check( mzed_cmp(D0, C1) == 0); printf("."); fflush(0);
+
+      mzd_slice_set_ui(c, 1);
+      mzd_slice_mul_execute(splan, c, a, b);
+      mzed_cling(C1, c);
+      m4rie_check( mzed_cmp(C0, C1) == 0); printf("."); fflush(0);
+
+      mzed_slice(c, D);
+      mzd_slice_addmul_execute(splan, c, a, b);
+      mzed_cling(C1, c);
+      m4rie_check( mzed_cmp(D0, C1) == 0); printf("."); fflush(0);
+    }
+
+    if (plan->nthreads == 1) {
+      m4rie_check( (plan->ws[0]->misses == misses) ); printf("."); fflush(0);
+    }
+    if (splan->nthreads == 1) {
+      m4rie_check( (splan->ws[0]->misses == smisses) ); printf("."); fflush(0);
+    }
+    if ((i >> 1) == 1) {
+      m4rie_check( (plan->algorithm == M4RIE_MUL_KARATSUBA) );
+      m4rie_check( (splan->algorithm == M4RIE_MUL_BLM) ); printf("."); fflush(0);
+    }
+
+    mzed_mul_plan_free(plan);
+    mzd_slice_mul_plan_free(splan);
+  }
+  m4rie_set_num_threads(0);
+  m4rie_profile_set(NULL);
+
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(D);
+  mzed_free(C0);
+  mzed_free(D0);
+  mzed_free(C1);
+  mzd_slice_free(a);
+  mzd_slice_free(b);
+  mzd_slice_free(c);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
+int test_prepared(gf2e *ff, rci_t m, rci_t l, rci_t n) {
+  int fail_ret = 0;
+  printf("mul: k: %2d, minpoly: 0x%05x m: %5d, l: %5d, n: %5d prepared ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)l, (int)n);
+
+  mzed_t *B = random_mzed_t(ff, l, n);
+  mzed_t *C1 = mzed_init(ff, m, n);
+  mzd_slice_t *c = mzd_slice_init(ff, m, n);
+
+  /* small crossovers, so that Karatsuba and bilinear maps are used for the second round */
+  m4rie_profile_t p;
+  m4rie_profile_defaults(&p);
+  p.karatsuba[ff->degree] = 64;
+  p.blm[ff->degree] = 64;
+
+  for(int i=0; i<2; i++) {
+    m4rie_profile_set(i ? &p : NULL);
+    mzed_prepared_t *P = mzed_prepared_init(B);
+    if (i == 1) {
+      m4rie_check( (P->GB != NULL) ); printf("."); fflush(0);
+    } else if (ff->degree <= 8) {
+      m4rie_check( (P->T != NULL) ); printf("."); fflush(0);
+    }
+
+    for(int j=0; j<2; j++) {
+      mzed_t *A = random_mzed_t(ff, m, l);
+      mzed_t *D = random_mzed_t(ff, m, n);
+      mzed_t *C0 = mzed_mul_naive(NULL, A, B);
+      mzed_t *D0 = mzed_addmul_naive(mzed_copy(NULL, D), A, B);
+      mzd_slice_t *a = mzed_slice(NULL, A);
+
+      mzed_set_ui(C1, 1);
+      mzed_mul_prepared(C1, A, P);
+      m4rie_check( mzed_cmp(C0, C1) == 0); printf("."); fflush(0);
+
+      mzed_copy(C1, D);
+      mzed_addmul_prepared(C1, A, P);
+      m4rie_check( mzed_cmp(D0, C1) == 0); printf("."); fflush(0);
+
+      /* tiles at non-zero offsets of B */
+      mzed_copy(C1, D);
+      _mzed_addmul_karatsuba_prepared(C1, A, P, 64);
+      m4rie_check( mzed_cmp(D0, C1) == 0); printf("."); fflush(0);
+
+      mzd_slice_set_ui(c, 1);
+      mzd_slice_mul_prepared(c, a, P);
+      mzed_cling(C1, c);
+      m4rie_check( mzed_cmp(C0, C1) == 0); printf("."); fflush(0);
+
+      mzed_slice(c, D);
+      mzd_slice_addmul_prepared(c, a, P);
+      mzed_cling(C1, c);
+      m4rie_check( mzed_cmp(D0, C1) == 0); printf("."); fflush(0);
+
+      mzed_free(A);
+      mzed_free(D);
+      mzed_free(C0);
+      mzed_free(D0);
+      mzd_slice_free(a);
+    }
+    mzed_prepared_free(P);
+  }
+  m4rie_profile_set(NULL);
+
+  mzed_free(B);
+  mzed_free(C1);
+  mzd_slice_free(c);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
 int main(int argc, char **argv) {
   srandom(17);
 
@@ -240,9 +895,44 @@ int main(int argc, char **argv) {
       fail_ret += test_batch(ff, 127, 128, 129);
       fail_ret += test_batch(ff, 200,  20, 112);
     }
+    fail_ret += test_mul_threads(ff, 257, 263, 269, "karatsuba threads", mzed_mul_karatsuba, mzed_addmul_karatsuba,
+                                 NULL, NULL, (const int[]){1, 4}, 2);
+    fail_ret += test_mul_threads(ff, 200, 190, 210, "karatsuba tiled", _mul_karatsuba_tiled, _addmul_karatsuba_tiled,
+                                 mzed_mul_karatsuba, mzed_addmul_karatsuba, (const int[]){1, 0}, 2);
+    if(k<=8 || runlong)
+      fail_ret += test_mul_threads(ff, 520, 530, 540, "karatsuba tiled", _mul_karatsuba_tiled, _addmul_karatsuba_tiled,
+                                   mzed_mul_karatsuba, mzed_addmul_karatsuba, (const int[]){1, 0}, 2);
+    if(k<=12 || runlong)
+      fail_ret += test_mul_threads(ff, 257, 263, 269, "newton-john threads", mzed_mul_newton_john, mzed_addmul_newton_john,
+                                   NULL, NULL, (const int[]){1, 4}, 2);
+    /* B is wider than one strip and l is no multiple of the number of tables built at once */
+    if(k<=12 || runlong)
+      fail_ret += test_mul_threads(ff, 300, 43, 1000, "newton-john strips", mzed_mul_newton_john, mzed_addmul_newton_john,
+                                   mzed_mul_naive, mzed_addmul_naive, (const int[]){1, 4}, 2);
+    fail_ret += test_newton_john_pool(ff, 33, 200);
+    /* large enough for the pointwise products to be spread over threads */
+    fail_ret += test_mul_threads(ff, 260, 270, 250, "blm stream", _mul_blm_stream, _addmul_blm_stream,
+                                 mzed_mul_karatsuba, mzed_addmul_karatsuba, (const int[]){1, 4}, 2);
+    fail_ret += test_mul_threads(ff, 260, 270, 250, "blm stream prepared", _mul_blm_stream_prepared, _addmul_blm_stream_prepared,
+                                 mzed_mul_karatsuba, mzed_addmul_karatsuba, (const int[]){1, 4}, 2);
+    /* 4 threads use one level of parallel products, 8 threads use two */
+    if(k<=8 || runlong)
+      fail_ret += test_mul_threads(ff, 517, 530, 543, "strassen threads", _mul_strassen, _addmul_strassen,
+                                   NULL, NULL, (const int[]){1, 4, 8}, 3);
+    fail_ret += test_blm_cache(ff, 21, 22, 23);
+    fail_ret += test_blm_stream(ff, 40, 50, 60);
+    fail_ret += test_profile(ff, 130, 140, 150);
+    fail_ret += test_scalar_cache(ff, 400, 333);
+    if(k<=8 || runlong)
+      fail_ret += test_workspace(ff, 300, 310, 320);
+    if(k<=12 || runlong)
+      fail_ret += test_plan(ff, 140, 150, 130);
+    fail_ret += test_prepared(ff, 70, 150, 140);
 
     gf2e_free(ff);
   }
 
+  blm_cache_clear();
+
   return fail_ret;
 }
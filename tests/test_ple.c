@@ -204,6 +204,77 @@ int test_batch(gf2e *ff, const rci_t m, const rci_t n, const rci_t r) {
   return fail_ret;
 }
 
+int test_mzed_lazy(gf2e *ff, const rci_t m, const rci_t n) {
+  printf("ple: k: %2d, minpoly: 0x%05x m: %5d, n: %5d lazy ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m, (int)n);
+
+  int fail_ret = 0;
+
+  mzed_t *A = random_mzed_t_rank(ff, m, m, m);
+  mzed_t *B = random_mzed_t(ff, m, n);
+  mzed_t *C = random_mzed_t(ff, m, n);
+
+  /* PLE -> TRSM -> addmul on mzed_t */
+  mzed_t *LE = mzed_copy(NULL, A);
+  mzp_t *P0 = mzp_init(m);
+  mzp_t *Q0 = mzp_init(m);
+  mzed_ple(LE, P0, Q0);
+  mzed_t *X = mzed_copy(NULL, B);
+  mzed_trsm_lower_left(LE, X);
+  mzed_trsm_upper_left(LE, X);
+  mzed_t *D = mzed_copy(NULL, C);
+  mzed_addmul(D, A, X);
+  mzed_t *E = mzed_mul(NULL, A, X);
+
+  /* the same chain converts every operand at most once */
+  mzed_lazy_t *LEl = mzed_lazy_from_mzed(mzed_copy(NULL, A));
+  mzed_lazy_t *Al  = mzed_lazy_from_mzed(mzed_copy(NULL, A));
+  mzed_lazy_t *Xl  = mzed_lazy_from_mzed(mzed_copy(NULL, B));
+  mzed_lazy_t *Dl  = mzed_lazy_from_mzed(mzed_copy(NULL, C));
+  mzp_t *P1 = mzp_init(m);
+  mzp_t *Q1 = mzp_init(m);
+  mzed_lazy_ple(LEl, P1, Q1);
+  mzed_lazy_trsm_lower_left(LEl, Xl);
+  mzed_lazy_trsm_upper_left(LEl, Xl);
+  mzed_lazy_addmul(Dl, Al, Xl);
+  mzed_lazy_t *El = mzed_lazy_mul(NULL, Al, Xl);
+
+  m4rie_check( (LEl->conversions <= 1) ); printf("."); fflush(0);
+  m4rie_check( (Al->conversions <= 1) ); printf("."); fflush(0);
+  m4rie_check( (Xl->conversions <= 1) ); printf("."); fflush(0);
+  m4rie_check( (Dl->conversions <= 1) ); printf("."); fflush(0);
+  m4rie_check( El->conversions == 0 ); printf("."); fflush(0);
+
+  m4rie_check( mzed_cmp(LE, (mzed_t*)mzed_lazy_read_mzed(LEl)) == 0 ); printf("."); fflush(0);
+  m4rie_check( mzed_cmp(X, (mzed_t*)mzed_lazy_read_mzed(Xl)) == 0 ); printf("."); fflush(0);
+  m4rie_check( mzed_cmp(D, (mzed_t*)mzed_lazy_read_mzed(Dl)) == 0 ); printf("."); fflush(0);
+  m4rie_check( mzed_cmp(E, (mzed_t*)mzed_lazy_read_mzed(El)) == 0 ); printf("."); fflush(0);
+
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(C);
+  mzed_free(LE);
+  mzed_free(X);
+  mzed_free(D);
+  mzed_free(E);
+  mzp_free(P0);
+  mzp_free(Q0);
+
+  mzed_lazy_free(LEl);
+  mzed_lazy_free(Al);
+  mzed_lazy_free(Xl);
+  mzed_lazy_free(Dl);
+  mzed_lazy_free(El);
+  mzp_free(P1);
+  mzp_free(Q1);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
 int main(int argc, char **argv) {
   srandom(17);
 
@@ -242,6 +313,10 @@ int main(int argc, char **argv) {
       fail_ret += test_batch(ff, 127, 129, 127);
       fail_ret += test_batch(ff, 200, 112, 111);
     }
+    if(k <= 8 || runlong) {
+      fail_ret += test_mzed_lazy(ff, 100,  90);
+      fail_ret += test_mzed_lazy(ff, 520, 530);
+    }
     gf2e_free(ff);
   }
 
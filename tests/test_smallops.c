@@ -35,6 +35,32 @@ int test_gf2e(gf2e *ff) {
   return fail_ret;
 }
 
+int test_log_tables(const word minpoly) {
+  int fail_ret = 0;
+  gf2e *ff = gf2e_init_flags(minpoly, M4RIE_GF2E_LOG_TABLES);
+  printf("testing k: %2d, log tables ",ff->degree);
+
+  for(word a=1; a < __M4RI_TWOPOW(ff->degree); a++)
+    m4rie_check( (_gf2e_mul_arith(ff, a, gf2e_inv(ff, a)) == 1) );
+  printf("."); fflush(0);
+
+  for(int i=0; i<1024; i++) {
+    const word a = random() & __M4RI_LEFT_BITMASK(ff->degree);
+    const word b = random() & __M4RI_LEFT_BITMASK(ff->degree);
+    m4rie_check( (gf2e_mul(ff, a, b) == _gf2e_mul_arith(ff, a, b)) );
+    m4rie_check( (ff->mul(ff, a, b) == _gf2e_mul_arith(ff, a, b)) );
+  }
+  printf("."); fflush(0);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  gf2e_free(ff);
+  return fail_ret;
+}
+
 int test_slice(gf2e *ff, int m, int n) {
   int fail_ret = 0;
 
@@ -158,6 +184,289 @@ int test_add(gf2e *ff, int m, int n) {
   return fail_ret; 
 }
 
+int test_row_ops(gf2e *ff, int m, int n) {
+  int fail_ret = 0;
+
+  mzed_t *A = random_mzed_t(ff, m, n);
+  mzed_t *B = random_mzed_t(ff, m, n);
+  mzed_t *C = mzed_copy(NULL, A);
+  mzed_set_canary(A);
+  mzed_set_canary(B);
+  mzed_set_canary(C);
+
+  const word mask = __M4RI_TWOPOW(ff->degree) - 1;
+
+  for(int i=0; i<m; i++) {
+    const word x = random() & mask;
+    const rci_t c = random() % n;
+    const rci_t r = random() % m;
+
+    mzed_add_multiple_of_row(A, i, B, r, x, c);
+    for(rci_t j=c; j<n; j++)
+      mzed_add_elem(C, i, j, ff->mul(ff, x, mzed_read_elem(B, r, j)));
+
+    if (x) {
+      mzed_rescale_row(A, i, c, x);
+      for(rci_t j=c; j<n; j++)
+        mzed_write_elem(C, i, j, ff->mul(ff, x, mzed_read_elem(C, i, j)));
+    }
+  }
+
+  m4rie_check( mzed_cmp(A, C) == 0 );
+
+  m4rie_check( mzed_canary_is_alive(A) );
+  m4rie_check( mzed_canary_is_alive(B) );
+  m4rie_check( mzed_canary_is_alive(C) );
+
+  mzed_free(A);
+  mzed_free(B);
+  mzed_free(C);
+
+  return fail_ret;
+}
+
+int test_row_dot(gf2e *ff, int m, int n) {
+  int fail_ret = 0;
+
+  mzed_t *A = random_mzed_t(ff, m, n);
+  mzed_t *B = random_mzed_t(ff, m, n);
+
+  for(int i=0; i<m; i++) {
+    const rci_t r = random() % m;
+    word d = 0;
+    for(rci_t j=0; j<n; j++)
+      d ^= ff->mul(ff, mzed_read_elem(A, i, j), mzed_read_elem(B, r, j));
+    m4rie_check( (mzed_row_dot(A, i, B, r) == d) );
+  }
+
+  mzed_free(A);
+  mzed_free(B);
+
+  return fail_ret;
+}
+
+int test_pivot_search(gf2e *ff, int m, int n) {
+  int fail_ret = 0;
+
+  /* sparse, so that searches cross words */
+  mzed_t *A = random_mzed_t(ff, m, n);
+  for(rci_t i=0; i<m; i++)
+    for(rci_t j=0; j<n; j++)
+      if (random() % 8)
+        mzed_write_elem(A, i, j, 0);
+
+  for(int t=0; t<m; t++) {
+    const rci_t r = random() % m;
+    const rci_t c0 = random() % n;
+    const rci_t c1 = c0 + random() % (n - c0 + 1);
+    rci_t c = c0;
+    while (c < c1 && mzed_read_elem(A, r, c) == 0)
+      c++;
+    m4rie_check( (mzed_first_nonzero_in_row(A, r, c0, c1) == c) );
+  }
+
+  /* first stays valid while A does not change and searches move down and right */
+  rci_t *first = (rci_t*)m4ri_mm_calloc(m, sizeof(rci_t));
+  rci_t r0 = 0, c0 = 0;
+  while (r0 < m && c0 < n) {
+    rci_t pr = m, pc = n;
+    for(rci_t j=c0; j<n && pr == m; j++)
+      for(rci_t i=r0; i<m; i++)
+        if (mzed_read_elem(A, i, j)) {
+          pr = i;
+          pc = j;
+          break;
+        }
+    rci_t r = m, c = n;
+    const int found = mzed_find_pivot(A, r0, c0, n, first, &r, &c);
+    m4rie_check( (found == (pr < m)) );
+    if (!found)
+      break;
+    m4rie_check( (r == pr && c == pc) );
+    r0 += 1 + random() % 2;
+    c0 = pc + random() % 2;
+  }
+  m4ri_mm_free(first);
+
+  mzed_free(A);
+
+  return fail_ret;
+}
+
+int test_kernels(gf2e *ff, int m, int n) {
+  int fail_ret = 0;
+  const unsigned int variants[6] = {0, M4RIE_CPU_SSSE3, M4RIE_CPU_AVX2, M4RIE_CPU_AVX2 | M4RIE_CPU_GFNI, M4RIE_CPU_PCLMUL, M4RIE_CPU_BMI2};
+  const unsigned int available = gf2e_cpu_features();
+
+  /* reference conversion with the portable kernels */
+  gf2e_select_kernels(ff, 0);
+  mzed_t *A = random_mzed_t(ff, m, n);
+  mzd_slice_t *a = mzed_slice(NULL, A);
+
+  for(int v=0; v<6; v++) {
+    if ((variants[v] & available) != variants[v])
+      continue;
+    gf2e_select_kernels(ff, variants[v]);
+
+    mzd_slice_t *b = random_mzd_slice_t(ff, m, n);
+    mzed_slice(b, A);
+    m4rie_check( mzd_slice_cmp(a, b) == 0 );
+    mzed_t *B = mzed_cling(NULL, b);
+    m4rie_check( mzed_cmp(A, B) == 0 );
+    mzd_slice_free(b);
+    mzed_free(B);
+    m4rie_check( test_slice_known_answers(ff, m, n) == 0);
+
+    for(int i=0; i<1024; i++) {
+      const word a = random() & __M4RI_LEFT_BITMASK(ff->degree);
+      const word b = random() & __M4RI_LEFT_BITMASK(ff->degree);
+      m4rie_check( (ff->mul(ff, a, b) == _gf2e_mul_arith(ff, a, b)) );
+    }
+    m4rie_check( test_row_ops(ff, m, n) == 0);
+    m4rie_check( test_row_ops(ff, n, m) == 0);
+    m4rie_check( test_row_dot(ff, m, n) == 0);
+  }
+  gf2e_select_kernels(ff, available);
+
+  mzed_free(A);
+  mzd_slice_free(a);
+
+  return fail_ret;
+}
+
+/**
+ * Convert between windows of A and S which start at row r and column m4ri_radix.
+ */
+
+static void convert_windows(mzd_slice_t *T, mzed_t *U, const mzed_t *A, const mzd_slice_t *S, rci_t r) {
+  mzd_slice_t *Tw = mzd_slice_init_window(T, r, m4ri_radix, T->nrows, T->ncols);
+  mzed_t *Aw = mzed_init_window(A, r, m4ri_radix, A->nrows, A->ncols);
+  mzed_slice(Tw, Aw);
+  mzed_free_window(Aw);
+  mzd_slice_free_window(Tw);
+
+  mzed_t *Uw = mzed_init_window(U, r, m4ri_radix, U->nrows, U->ncols);
+  mzd_slice_t *Sw = mzd_slice_init_window(S, r, m4ri_radix, S->nrows, S->ncols);
+  mzed_cling(Uw, Sw);
+  mzd_slice_free_window(Sw);
+  mzed_free_window(Uw);
+}
+
+int test_slice_parallel(gf2e *ff, int m, int n) {
+  int fail_ret = 0;
+
+  mzed_t *A = random_mzed_t(ff, m, n);
+  mzd_slice_t *S = random_mzd_slice_t(ff, m, n);
+
+  /* reference with one thread */
+  m4rie_set_num_threads(1);
+  mzd_slice_t *a = mzed_slice(NULL, A);
+  mzed_t *b = mzed_cling(NULL, S);
+  mzd_slice_t *T = mzd_slice_copy(NULL, S);
+  mzed_t *U = mzed_copy(NULL, A);
+  convert_windows(T, U, A, S, 3);
+
+  m4rie_set_num_threads(0);
+  mzd_slice_t *a2 = mzed_slice(NULL, A);
+  mzed_t *b2 = mzed_cling(NULL, S);
+  mzd_slice_t *T2 = mzd_slice_copy(NULL, S);
+  mzed_t *U2 = mzed_copy(NULL, A);
+  mzd_slice_set_canary(T2);
+  mzed_set_canary(U2);
+  convert_windows(T2, U2, A, S, 3);
+
+  m4rie_check( mzd_slice_cmp(a, a2) == 0 );
+  m4rie_check( mzed_cmp(b, b2) == 0 );
+  m4rie_check( mzd_slice_cmp(T, T2) == 0 );
+  m4rie_check( mzed_cmp(U, U2) == 0 );
+  m4rie_check( mzd_slice_canary_is_alive(T2) );
+  m4rie_check( mzed_canary_is_alive(U2) );
+
+  /* rows above the windows are untouched */
+  for(rci_t i=0; i<3; i++)
+    for(rci_t j=0; j<n; j++) {
+      m4rie_check( (mzd_slice_read_elem(T2, i, j) == mzd_slice_read_elem(S, i, j)) );
+      m4rie_check( (mzed_read_elem(U2, i, j) == mzed_read_elem(A, i, j)) );
+    }
+
+  mzd_slice_free(a);  mzd_slice_free(a2);
+  mzd_slice_free(T);  mzd_slice_free(T2);
+  mzed_free(b);  mzed_free(b2);
+  mzed_free(U);  mzed_free(U2);
+  mzd_slice_free(S);
+  mzed_free(A);
+  return fail_ret;
+}
+
+int test_split_tables(gf2e *ff, int m, int n) {
+  int fail_ret = 0;
+  const rci_t c = 3;
+
+  /* reduced pivot rows in columns c, ..., c+5 */
+  mzed_t *E = random_mzed_t(ff, 6, n);
+  njt_mzed_t *T[6];
+  for(int i=0; i<6; i++) {
+    for(int j=0; j<6; j++)
+      mzed_write_elem(E, i, c+j, (i == j));
+    T[i] = njt_mzed_init(ff, n);
+    mzed_make_table(T[i], E, i, c);
+  }
+  m4rie_check( (T[0]->T1 != NULL) );
+
+  mzed_t *M = random_mzed_t(ff, m, n);
+  for(int k=1; k<=6; k++) {
+    mzed_t *M0 = mzed_copy(NULL, M);
+    mzed_t *M1 = mzed_copy(NULL, M);
+    mzed_set_canary(M1);
+
+    for(rci_t r=0; r<m; r++) {
+      word a[6];
+      for(int i=0; i<k; i++)
+        a[i] = mzed_read_elem(M0, r, c+i);
+      for(int i=0; i<k; i++)
+        mzed_add_multiple_of_row(M0, r, E, i, a[i], c);
+    }
+
+    switch(k) {
+    case 1: mzed_process_rows (M1, 0, m, c, T[0]); break;
+    case 2: mzed_process_rows2(M1, 0, m, c, T[0], T[1]); break;
+    case 3: mzed_process_rows3(M1, 0, m, c, T[0], T[1], T[2]); break;
+    case 4: mzed_process_rows4(M1, 0, m, c, T[0], T[1], T[2], T[3]); break;
+    case 5: mzed_process_rows5(M1, 0, m, c, T[0], T[1], T[2], T[3], T[4]); break;
+    case 6: mzed_process_rows6(M1, 0, m, c, T[0], T[1], T[2], T[3], T[4], T[5]); break;
+    }
+    m4rie_check( mzed_cmp(M0, M1) == 0 );
+    m4rie_check( mzed_canary_is_alive(M1) );
+
+    mzed_free(M0);
+    mzed_free(M1);
+  }
+
+  /* products and echelon forms built from split tables */
+  mzed_t *B = random_mzed_t(ff, n, m);
+  mzed_t *C0 = mzed_mul_naive(NULL, M, B);
+  mzed_t *C1 = mzed_mul_newton_john(NULL, M, B);
+  m4rie_check( mzed_cmp(C0, C1) == 0 );
+
+  mzed_t *A0 = mzed_copy(NULL, M);
+  mzed_t *A1 = mzed_copy(NULL, M);
+  const rci_t r0 = mzed_echelonize_naive(A0, 1);
+  const rci_t r1 = mzed_echelonize_newton_john(A1, 1);
+  m4rie_check( (r0 == r1) );
+  m4rie_check( mzed_cmp(A0, A1) == 0 );
+
+  for(int i=0; i<6; i++)
+    njt_mzed_free(T[i]);
+  mzed_free(A0);
+  mzed_free(A1);
+  mzed_free(B);
+  mzed_free(C0);
+  mzed_free(C1);
+  mzed_free(M);
+  mzed_free(E);
+  return fail_ret;
+}
+
 int test_batch(gf2e *ff, int m, int n) {
   int fail_ret = 0;
   printf("testing k: %2d, m: %4d, n: %4d ",ff->degree,m,n);
@@ -178,6 +487,11 @@ int test_batch(gf2e *ff, int m, int n) {
   m4rie_check( test_add(ff, n, n) == 0) ;   printf("."); fflush(0);
   m4rie_check( test_slice_known_answers(ff, n, n) == 0); printf("."); fflush(0);
 
+  m4rie_check( test_kernels(ff, m, n) == 0); printf("."); fflush(0);
+
+  m4rie_check( test_pivot_search(ff, m, n) == 0); printf("."); fflush(0);
+  m4rie_check( test_pivot_search(ff, n, m) == 0); printf("."); fflush(0);
+
   m4rie_check( test_gf2e(ff) == 0); printf("."); fflush(0);
 
   if (fail_ret == 0)
@@ -210,6 +524,26 @@ int main(int argc, char **argv) {
     fail_ret += test_batch(ff,  65, 129);
     fail_ret += test_batch(ff, 201, 200);
     fail_ret += test_batch(ff, 217,   2);
+    fail_ret += test_log_tables(irreducible_polynomials[k][1]);
+
+    /* large enough to be converted by several threads */
+    printf("testing k: %2d, parallel conversion ",ff->degree);
+    if (test_slice_parallel(ff, 1100, 4096/gf2e_degree_to_w(ff) + 65) == 0) {
+      printf("passed\n");
+    } else {
+      printf("FAILED\n");
+      fail_ret++;
+    }
+
+    if (ff->degree > __M4RIE_NJT_SPLIT) {
+      printf("testing k: %2d, split tables ",ff->degree);
+      if (test_split_tables(ff, 70, 140) == 0) {
+        printf("passed\n");
+      } else {
+        printf("FAILED\n");
+        fail_ret++;
+      }
+    }
     gf2e_free(ff);
   }
 
@@ -417,6 +417,72 @@ int test_batch(gf2e *ff, rci_t m, rci_t n) {
   return fail_ret;
 }
 
+int test_newton_john_cutoff(gf2e *ff, rci_t m, rci_t n) {
+  int fail_ret = 0;
+  printf("trsm: k: %2d, minpoly: 0x%05x m: %5d, n: %5d newton-john cutoff ",(int)ff->degree, (unsigned int)ff->minpoly, (int)m,(int)n);
+
+  mzed_t *U = random_mzed_t_upper_left(ff, m);
+  mzed_t *L = random_mzed_t_lower_left(ff, m);
+  mzed_t *B = random_mzed_t(ff, m, n);
+
+  mzed_t *X0 = mzed_copy(NULL, B);
+  mzed_t *Y0 = mzed_copy(NULL, B);
+  mzed_trsm_upper_left_naive(U, X0);
+  mzed_trsm_lower_left_naive(L, Y0);
+
+  m4rie_profile_t p;
+  m4rie_profile_defaults(&p);
+
+  /* the profile decides whether the Newton-John functions fall back to naive */
+  for(int i=0; i<2; i++) {
+    p.trsm_newton_john[ff->degree] = (i == 0) ? 1 : m;
+    m4rie_profile_set(&p);
+
+    mzed_t *X1 = mzed_copy(NULL, B);
+    mzed_t *Y1 = mzed_copy(NULL, B);
+    mzed_set_canary(X1);
+    mzed_set_canary(Y1);
+    mzed_trsm_upper_left_newton_john(U, X1);
+    mzed_trsm_lower_left_newton_john(L, Y1);
+    m4rie_check( mzed_cmp(X0, X1) == 0); printf("."); fflush(0);
+    m4rie_check( mzed_cmp(Y0, Y1) == 0); printf("."); fflush(0);
+    m4rie_check( mzed_canary_is_alive(X1) );
+    m4rie_check( mzed_canary_is_alive(Y1) );
+
+    mzd_slice_t *u = mzed_slice(NULL, U);
+    mzd_slice_t *l = mzed_slice(NULL, L);
+    mzd_slice_t *x = mzed_slice(NULL, B);
+    mzd_slice_t *y = mzed_slice(NULL, B);
+    mzd_slice_trsm_upper_left_newton_john(u, x);
+    mzd_slice_trsm_lower_left_newton_john(l, y);
+    mzed_cling(X1, x);
+    mzed_cling(Y1, y);
+    m4rie_check( mzed_cmp(X0, X1) == 0); printf("."); fflush(0);
+    m4rie_check( mzed_cmp(Y0, Y1) == 0); printf("."); fflush(0);
+
+    mzd_slice_free(u);
+    mzd_slice_free(l);
+    mzd_slice_free(x);
+    mzd_slice_free(y);
+    mzed_free(X1);
+    mzed_free(Y1);
+  }
+  m4rie_profile_set(NULL);
+
+  mzed_free(U);
+  mzed_free(L);
+  mzed_free(B);
+  mzed_free(X0);
+  mzed_free(Y0);
+
+  if (fail_ret == 0)
+    printf(" passed\n");
+  else
+    printf(" FAILED\n");
+
+  return fail_ret;
+}
+
 int main(int argc, char **argv) {
   srandom(17);
 
@@ -441,6 +507,7 @@ int main(int argc, char **argv) {
       fail_ret += test_batch(ff, 127, 128);
       fail_ret += test_batch(ff, 200,  20);
     }
+    fail_ret += test_newton_john_cutoff(ff, 70, 50);
     gf2e_free(ff);
   }
 